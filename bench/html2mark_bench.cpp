@@ -0,0 +1,380 @@
+#include "../src/html2mark.h"
+#include "../src/tokenizer.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+// Every heap allocation in the process is counted,
+// so that allocations made by conversion can be reported.
+static size_t allocation_count = 0;
+
+void * operator new(size_t size)
+{
+	++allocation_count;
+	void * ptr = malloc(size == 0 ? 1 : size);
+	if(ptr == nullptr) {
+		throw std::bad_alloc();
+	}
+	return ptr;
+}
+
+void operator delete(void * ptr) noexcept
+{
+	free(ptr);
+}
+
+// CPU cycles spent by this thread in user space.
+// Not available when the kernel does not allow perf events.
+class CycleCounter {
+public:
+	CycleCounter();
+	~CycleCounter();
+	bool available() const { return fd >= 0; }
+	void start();
+	uint64_t stop();
+private:
+	int fd;
+};
+
+CycleCounter::CycleCounter()
+	: fd(-1)
+{
+#ifdef __linux__
+	perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.size = sizeof(attr);
+	attr.config = PERF_COUNT_HW_CPU_CYCLES;
+	attr.disabled = 1;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	fd = int(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+}
+
+CycleCounter::~CycleCounter()
+{
+	if(fd >= 0) {
+		close(fd);
+	}
+}
+
+void CycleCounter::start()
+{
+#ifdef __linux__
+	if(fd >= 0) {
+		ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+		ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+	}
+#endif
+}
+
+uint64_t CycleCounter::stop()
+{
+	uint64_t cycles = 0;
+#ifdef __linux__
+	if(fd >= 0) {
+		ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+		if(read(fd, &cycles, sizeof(cycles)) != ssize_t(sizeof(cycles))) {
+			cycles = 0;
+		}
+	}
+#endif
+	return cycles;
+}
+
+static std::string make_document(size_t size)
+{
+	std::string html = "<html><body>";
+	unsigned index = 0;
+	while(html.size() < size) {
+		html += "<h2>Section " + std::to_string(++index) + "</h2>";
+		html += "<p>Lorem ipsum <b>dolor</b> sit amet, <i>consectetur</i> adipisicing elit, "
+			"sed do <a href=\"http://www.example.com/data/" + std::to_string(index) + "\">eiusmod</a> "
+			"tempor incididunt ut labore et dolore magna aliqua.</p>";
+		html += "<ul><li>one</li><li>two <code>code</code></li><li>three</li></ul>";
+		html += "<pre>int main()\n{\n\treturn 0;\n}</pre>";
+	}
+	html += "</body></html>";
+	return html;
+}
+
+// Chinese text, which has no spaces to break lines at.
+static std::string make_cjk_document(size_t size)
+{
+	std::string html = "<html><body>";
+	while(html.size() < size) {
+		html += "<h1>\xe4\xb8\xad\xe6\x96\x87\xe6\xa0\x87\xe9\xa2\x98</h1><p>";
+		for(int i = 0; i < 20; ++i) {
+			html += "\xe8\xbf\x99\xe6\x98\xaf\xe4\xb8\x80\xe4\xb8\xaa\xe6\xb5\x8b\xe8\xaf\x95"
+				"\xe6\x96\x87\xe6\x9c\xac\xef\xbc\x8c\xe7\x94\xa8\xe4\xba\x8e\xe6\x8d\xa2\xe8\xa1\x8c\xe3\x80\x82";
+		}
+		html += "</p>";
+	}
+	html += "</body></html>";
+	return html;
+}
+
+static std::string make_nested_document(size_t depth)
+{
+	static const char * const tags[] = {"div", "span", "b", "i", "a", "em"};
+	std::string html;
+	for(size_t i = 0; i < depth; ++i) {
+		html += std::string("<") + tags[i % 6] + ">x ";
+	}
+	for(size_t i = depth; i > 0; --i) {
+		html += std::string("</") + tags[(i - 1) % 6] + ">";
+	}
+	return html;
+}
+
+static std::string make_list_document(size_t items)
+{
+	std::string html = "<ul>";
+	for(size_t i = 0; i < items; ++i) {
+		html += "<li>item <b>" + std::to_string(i) + "</b></li>";
+	}
+	html += "</ul>";
+	return html;
+}
+
+static std::string make_links_document(size_t links)
+{
+	std::string html;
+	for(size_t i = 0; i < links; ++i) {
+		html += "<p>See <a href=\"http://www.example.com/some/rather/long/path/to/page/"
+			+ std::to_string(i) + ".html\" title=\"Page " + std::to_string(i) + "\">page</a>"
+			" and <img src=\"http://www.example.com/images/" + std::to_string(i) + ".png\" alt=\"image\"/></p>";
+	}
+	return html;
+}
+
+static std::string make_pre_document(size_t size)
+{
+	std::string html = "<pre><code>";
+	for(unsigned line = 0; html.size() < size; ++line) {
+		html += "\tfor(int i = 0; i < " + std::to_string(line) + "; ++i) {  sum &lt;&lt;= values[i];  }\n";
+	}
+	html += "</code></pre>";
+	return html;
+}
+
+static size_t count_tokens(const std::string & html)
+{
+	Html2Mark::Tokenizer tokenizer(html);
+	size_t tokens = 1;
+	while(tokenizer.next()) {
+		++tokens;
+	}
+	return tokens;
+}
+
+struct Result {
+	std::string name;
+	size_t input_size;
+	size_t output_size;
+	size_t tokens;
+	double seconds;
+	size_t allocations;
+	uint64_t cycles;
+};
+
+// Runs conversion a few times and keeps the best time.
+// Allocations are counted in the last run, when buffers are already warm.
+static Result measure(const std::string & name, const std::string & html,
+		CycleCounter & cycle_counter, const std::function<size_t()> & run)
+{
+	const int repeats = 5;
+	Result result;
+	result.name = name;
+	result.input_size = html.size();
+	result.output_size = 0;
+	result.tokens = count_tokens(html);
+	result.seconds = 0;
+	result.allocations = 0;
+	result.cycles = 0;
+	for(int i = 0; i < repeats; ++i) {
+		size_t allocations_before = allocation_count;
+		cycle_counter.start();
+		auto start = std::chrono::steady_clock::now();
+		result.output_size = run();
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+		uint64_t cycles = cycle_counter.stop();
+		result.allocations = allocation_count - allocations_before;
+		if(i == 0 || elapsed.count() < result.seconds) {
+			result.seconds = elapsed.count();
+		}
+		if(i == 0 || cycles < result.cycles) {
+			result.cycles = cycles;
+		}
+	}
+	return result;
+}
+
+static Result measure_converter(const std::string & name, const std::string & html,
+		CycleCounter & cycle_counter, int options, size_t wrap_width = 80)
+{
+	Html2Mark::Converter converter(options, 20, wrap_width);
+	std::string out;
+	return measure(name, html, cycle_counter, [&]() {
+			converter.convert(html, out);
+			return out.size();
+			});
+}
+
+static bool read_file(const std::string & filename, std::string & content)
+{
+	int fd = open(filename.c_str(), O_RDONLY);
+	if(fd < 0) {
+		return false;
+	}
+	content.clear();
+	char buffer[65536];
+	ssize_t size;
+	while((size = read(fd, buffer, sizeof(buffer))) > 0) {
+		content.append(buffer, size_t(size));
+	}
+	close(fd);
+	return size == 0;
+}
+
+// Regular files of the directory, sorted by name.
+static std::vector<std::string> list_files(const std::string & dirname)
+{
+	std::vector<std::string> files;
+	DIR * dir = opendir(dirname.c_str());
+	if(dir == nullptr) {
+		return files;
+	}
+	while(dirent * entry = readdir(dir)) {
+		std::string filename = dirname + "/" + entry->d_name;
+		struct stat info;
+		if(stat(filename.c_str(), &info) == 0 && S_ISREG(info.st_mode)) {
+			files.push_back(filename);
+		}
+	}
+	closedir(dir);
+	std::sort(files.begin(), files.end());
+	return files;
+}
+
+static std::string json_string(const std::string & value)
+{
+	std::string result = "\"";
+	for(char c : value) {
+		if(c == '"' || c == '\\') {
+			result += '\\';
+			result += c;
+		} else if(static_cast<unsigned char>(c) < 0x20) {
+			static const char digits[] = "0123456789abcdef";
+			result += "\\u00";
+			result += digits[(c >> 4) & 0xf];
+			result += digits[c & 0xf];
+		} else {
+			result += c;
+		}
+	}
+	return result + '"';
+}
+
+static void write_json(std::ostream & out, const std::vector<Result> & results, bool has_cycles)
+{
+	out << "{\n\t\"benchmarks\": [";
+	for(size_t i = 0; i < results.size(); ++i) {
+		const Result & result = results[i];
+		double size = double(result.input_size);
+		out << (i == 0 ? "\n" : ",\n") << "\t\t{"
+			<< "\"name\": " << json_string(result.name)
+			<< ", \"input_bytes\": " << result.input_size
+			<< ", \"output_bytes\": " << result.output_size
+			<< ", \"tokens\": " << result.tokens
+			<< ", \"seconds\": " << result.seconds
+			<< ", \"mb_per_s\": " << size / (1024 * 1024) / result.seconds
+			<< ", \"ns_per_token\": " << result.seconds * 1e9 / double(result.tokens)
+			<< ", \"allocations_per_kb\": " << double(result.allocations) * 1024 / size
+			<< ", \"cycles_per_byte\": ";
+		if(has_cycles) {
+			out << double(result.cycles) / size;
+		} else {
+			out << "null";
+		}
+		out << "}";
+	}
+	out << "\n\t]\n}\n";
+}
+
+// Usage: html2mark_bench [directory with HTML pages]
+// Prints results as JSON.
+int main(int argc, char ** argv)
+{
+	const int options = Html2Mark::UNDERSCORED_HEADINGS | Html2Mark::MAKE_REFERENCE_LINKS;
+	CycleCounter cycle_counter;
+	std::vector<Result> results;
+
+	const std::string html = make_document(4 * 1024 * 1024);
+	results.push_back(measure("std::string", html, cycle_counter, [&html]() {
+			return Html2Mark::html2mark(html, options).size();
+			}));
+	results.push_back(measure("std::istream", html, cycle_counter, [&html]() {
+			std::istringstream input(html);
+			return Html2Mark::html2mark(input, options).size();
+			}));
+	results.push_back(measure("StringView", html, cycle_counter, [&html]() {
+			Html2Mark::StringView view(html.data(), html.size());
+			return Html2Mark::html2mark(view, options).size();
+			}));
+	results.push_back(measure_converter("converter", html, cycle_counter, options));
+	results.push_back(measure_converter("colored and wrapped", html, cycle_counter,
+				options | Html2Mark::COLORS | Html2Mark::WRAP, 60));
+	results.push_back(measure_converter("CJK wrapped", make_cjk_document(4 * 1024 * 1024),
+				cycle_counter, options | Html2Mark::WRAP, 60));
+
+	for(size_t depth : {size_t(1000), size_t(10000)}) {
+		results.push_back(measure_converter("nesting " + std::to_string(depth),
+					make_nested_document(depth), cycle_counter, Html2Mark::DEFAULT_OPTIONS));
+	}
+	results.push_back(measure_converter("list of 100000 items",
+				make_list_document(100000), cycle_counter, options));
+	results.push_back(measure_converter("5000 reference links",
+				make_links_document(5000), cycle_counter, options));
+	results.push_back(measure_converter("pre of 1 MB",
+				make_pre_document(1024 * 1024), cycle_counter, options));
+
+	if(argc > 1) {
+		std::vector<std::string> files = list_files(argv[1]);
+		if(files.empty()) {
+			std::cerr << "No pages found in \"" << argv[1] << "\"!" << std::endl;
+			return 1;
+		}
+		std::string page;
+		for(const std::string & filename : files) {
+			if(!read_file(filename, page)) {
+				std::cerr << "Cannot read file \"" << filename << "\"!" << std::endl;
+				return 1;
+			}
+			if(!page.empty()) {
+				results.push_back(measure_converter(filename, page, cycle_counter, options));
+			}
+		}
+	}
+
+	write_json(std::cout, results, cycle_counter.available());
+	return 0;
+}
@@ -0,0 +1,267 @@
+#include "../src/protocol.h"
+#include "../src/html2mark.h"
+#include <algorithm>
+#include <chrono>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <dirent.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+typedef std::chrono::steady_clock Clock;
+
+struct Settings {
+	std::string socket_path;
+	size_t connections;
+	size_t requests;
+	uint32_t options;
+	uint32_t wrap_width;
+	uint32_t min_reference_links_length;
+	Settings()
+		: connections(4), requests(10000),
+		options(Html2Mark::UNDERSCORED_HEADINGS | Html2Mark::MAKE_REFERENCE_LINKS),
+		wrap_width(0), min_reference_links_length(20)
+	{}
+};
+
+// Snippet of the size that web pages usually ask to render.
+static std::string make_snippet()
+{
+	return "<div><h2>Release notes</h2><p>This release makes <b>conversion</b> faster "
+		"and fixes <a href=\"http://www.example.com/issues/1234/details\">a crash</a> "
+		"on <i>malformed</i> input.</p><ul><li>one</li><li>two <code>code</code></li></ul></div>";
+}
+
+static bool read_file(const std::string & filename, std::string & content)
+{
+	int fd = open(filename.c_str(), O_RDONLY);
+	if(fd < 0) {
+		return false;
+	}
+	content.clear();
+	char buffer[65536];
+	ssize_t size;
+	while((size = read(fd, buffer, sizeof(buffer))) > 0) {
+		content.append(buffer, size_t(size));
+	}
+	close(fd);
+	return size == 0;
+}
+
+// Files themselves, or regular files in directories, sorted by name.
+static std::vector<std::string> list_files(const std::vector<std::string> & names)
+{
+	std::vector<std::string> files;
+	for(const std::string & name : names) {
+		DIR * dir = opendir(name.c_str());
+		if(dir == nullptr) {
+			files.push_back(name);
+			continue;
+		}
+		std::vector<std::string> dir_files;
+		while(dirent * entry = readdir(dir)) {
+			std::string filename = name + "/" + entry->d_name;
+			struct stat info;
+			if(stat(filename.c_str(), &info) == 0 && S_ISREG(info.st_mode)) {
+				dir_files.push_back(filename);
+			}
+		}
+		closedir(dir);
+		std::sort(dir_files.begin(), dir_files.end());
+		files.insert(files.end(), dir_files.begin(), dir_files.end());
+	}
+	return files;
+}
+
+// Waits a little for the server, which may be starting just now.
+static int connect_to(const std::string & path)
+{
+	sockaddr_un address;
+	memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	if(path.size() >= sizeof(address.sun_path)) {
+		return -1;
+	}
+	memcpy(address.sun_path, path.data(), path.size());
+	for(int attempt = 0; attempt < 50; ++attempt) {
+		int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+		if(fd < 0) {
+			return -1;
+		}
+		if(connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == 0) {
+			return fd;
+		}
+		int error = errno;
+		close(fd);
+		if(error != ENOENT && error != ECONNREFUSED) {
+			return -1;
+		}
+		usleep(100000);
+	}
+	return -1;
+}
+
+struct Results {
+	std::mutex mutex;
+	std::vector<double> latencies;
+	size_t failed;
+	size_t output_size;
+	Results() : failed(0), output_size(0) {}
+};
+
+// Sends every connections-th request, starting with the first one.
+static void run_connection(const Settings & settings, const std::vector<std::string> & documents,
+		size_t first, Results & results)
+{
+	std::vector<double> latencies;
+	size_t failed = 0;
+	size_t output_size = 0;
+	int fd = connect_to(settings.socket_path);
+	Html2Mark::RequestHeader request;
+	request.kind = Html2Mark::CONVERT_REQUEST;
+	request.options = settings.options;
+	request.wrap_width = settings.wrap_width;
+	request.min_reference_links_length = settings.min_reference_links_length;
+	Html2Mark::ResponseHeader response;
+	std::string markdown;
+	for(size_t index = first; index < settings.requests; index += settings.connections) {
+		const std::string & html = documents[index % documents.size()];
+		request.size = uint32_t(html.size());
+		Clock::time_point start = Clock::now();
+		bool ok = fd >= 0 && Html2Mark::write_message(fd, request, html)
+			&& Html2Mark::read_header(fd, response)
+			&& Html2Mark::read_body(fd, response.size, markdown);
+		if(!ok || response.status != Html2Mark::RESPONSE_CONVERTED) {
+			++failed;
+			if(!ok) {
+				failed += (settings.requests - index - 1) / settings.connections;
+				break;
+			}
+			continue;
+		}
+		latencies.push_back(std::chrono::duration<double>(Clock::now() - start).count());
+		output_size += markdown.size();
+	}
+	if(fd >= 0) {
+		close(fd);
+	}
+	std::lock_guard<std::mutex> lock(results.mutex);
+	results.latencies.insert(results.latencies.end(), latencies.begin(), latencies.end());
+	results.failed += failed;
+	results.output_size += output_size;
+}
+
+static std::string server_stats(const std::string & socket_path)
+{
+	int fd = connect_to(socket_path);
+	Html2Mark::RequestHeader request;
+	request.kind = Html2Mark::STATS_REQUEST;
+	request.options = 0;
+	request.wrap_width = 0;
+	request.min_reference_links_length = 0;
+	Html2Mark::ResponseHeader response;
+	std::string stats;
+	bool ok = fd >= 0 && Html2Mark::write_message(fd, request, Html2Mark::StringView())
+		&& Html2Mark::read_header(fd, response)
+		&& Html2Mark::read_body(fd, response.size, stats);
+	if(fd >= 0) {
+		close(fd);
+	}
+	return ok ? stats : "null";
+}
+
+static double percentile(const std::vector<double> & sorted, size_t percent)
+{
+	if(sorted.empty()) {
+		return 0;
+	}
+	return sorted[std::min(sorted.size() - 1, sorted.size() * percent / 100)];
+}
+
+// Usage: html2mark_load [-c connections] [-n requests] [--options N] [--width N] [--min-reference N]
+//        socket [files or directories with HTML documents]
+// Sends conversion requests to html2mark --serve and prints results as JSON.
+int main(int argc, char ** argv)
+{
+	Settings settings;
+	static struct option long_options[] = {
+		{"connections", required_argument, nullptr, 'c'},
+		{"requests", required_argument, nullptr, 'n'},
+		{"options", required_argument, nullptr, 'o'},
+		{"width", required_argument, nullptr, 'w'},
+		{"min-reference", required_argument, nullptr, 'm'},
+		{nullptr, 0, nullptr, 0}
+	};
+	while(true) {
+		int option_index = 0;
+		int c = getopt_long(argc, argv, "c:n:", long_options, &option_index);
+		if(c == -1) {
+			break;
+		}
+		switch(c) {
+			case 'c': settings.connections = strtoul(optarg, nullptr, 10); break;
+			case 'n': settings.requests = strtoul(optarg, nullptr, 10); break;
+			case 'o': settings.options = uint32_t(strtoul(optarg, nullptr, 10)); break;
+			case 'w': settings.wrap_width = uint32_t(strtoul(optarg, nullptr, 10)); break;
+			case 'm': settings.min_reference_links_length = uint32_t(strtoul(optarg, nullptr, 10)); break;
+			case '?': break;
+			default: return 1;
+		}
+	}
+	if(optind >= argc || settings.connections == 0) {
+		std::cerr << "Usage: " << argv[0] << " [-c connections] [-n requests]"
+			" [--options N] [--width N] [--min-reference N] socket [files...]\n";
+		return 1;
+	}
+	settings.socket_path = argv[optind];
+
+	std::vector<std::string> documents;
+	for(const std::string & filename : list_files(std::vector<std::string>(argv + optind + 1, argv + argc))) {
+		std::string content;
+		if(!read_file(filename, content)) {
+			std::cerr << "Cannot read file \"" << filename << "\"!" << std::endl;
+			return 1;
+		}
+		documents.push_back(content);
+	}
+	if(documents.empty()) {
+		documents.push_back(make_snippet());
+	}
+
+	Results results;
+	std::vector<std::thread> threads;
+	Clock::time_point start = Clock::now();
+	for(size_t i = 0; i < settings.connections; ++i) {
+		threads.emplace_back(run_connection, std::cref(settings), std::cref(documents), i, std::ref(results));
+	}
+	for(std::thread & thread : threads) {
+		thread.join();
+	}
+	double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+	std::sort(results.latencies.begin(), results.latencies.end());
+
+	std::cout << "{\n\t\"connections\": " << settings.connections
+		<< ",\n\t\"requests\": " << settings.requests
+		<< ",\n\t\"failed_requests\": " << results.failed
+		<< ",\n\t\"seconds\": " << seconds
+		<< ",\n\t\"requests_per_s\": " << double(results.latencies.size()) / seconds
+		<< ",\n\t\"output_bytes\": " << results.output_size
+		<< ",\n\t\"latency_ms\": {"
+		<< "\"p50\": " << percentile(results.latencies, 50) * 1000
+		<< ", \"p90\": " << percentile(results.latencies, 90) * 1000
+		<< ", \"p99\": " << percentile(results.latencies, 99) * 1000
+		<< ", \"max\": " << percentile(results.latencies, 100) * 1000
+		<< "},\n\t\"server\": " << server_stats(settings.socket_path)
+		<< "\n}\n";
+	return results.failed == 0 ? 0 : 1;
+}
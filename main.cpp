@@ -1,53 +1,544 @@
 #include "src/html2mark.h"
+#include "src/result_cache.h"
+#include "src/thread_pool.h"
+#include "src/io.h"
+#include "server.h"
 #include <getopt.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
 #include <iostream>
-#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+
+// Whole input document. Regular files are mapped into memory,
+// pipes and terminals are read in large chunks.
+class Input {
+public:
+	Input() : mapping(nullptr), mapping_size(0) {}
+	~Input();
+	bool load(int fd);
+	Html2Mark::StringView view() const;
+private:
+	void * mapping;
+	size_t mapping_size;
+	std::string buffer;
+};
+
+Input::~Input()
+{
+	if(mapping) {
+		munmap(mapping, mapping_size);
+	}
+}
+
+bool Input::load(int fd)
+{
+	struct stat info;
+	if(fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+		mapping_size = size_t(info.st_size);
+		mapping = mmap(nullptr, mapping_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if(mapping != MAP_FAILED) {
+			madvise(mapping, mapping_size, MADV_SEQUENTIAL);
+			return true;
+		}
+		mapping = nullptr;
+	}
+	const size_t CHUNK_SIZE = 1 << 20;
+	size_t size = 0;
+	while(true) {
+		buffer.resize(size + CHUNK_SIZE);
+		ssize_t count = read(fd, &buffer[size], CHUNK_SIZE);
+		if(count < 0 && errno == EINTR) {
+			continue;
+		}
+		if(count < 0) {
+			return false;
+		}
+		if(count == 0) {
+			break;
+		}
+		size += size_t(count);
+	}
+	buffer.resize(size);
+	return true;
+}
+
+Html2Mark::StringView Input::view() const
+{
+	if(mapping) {
+		return Html2Mark::StringView(static_cast<const char *>(mapping), mapping_size);
+	}
+	return Html2Mark::StringView(buffer);
+}
+
+// Collects converted blocks and writes them out in large chunks.
+// Blocks that do not fit into the buffer are written together
+// with the buffered data by a single writev() call, without copying.
+class Output {
+public:
+	Output(int output_fd);
+	void write(const char * data, size_t size);
+	bool flush();
+private:
+	static const size_t BUFFER_SIZE = 1 << 18;
+	int fd;
+	bool failed;
+	std::string buffer;
+
+	void write_all(struct iovec * parts, int count);
+};
+
+Output::Output(int output_fd)
+	: fd(output_fd), failed(false)
+{
+	buffer.reserve(BUFFER_SIZE);
+}
+
+void Output::write(const char * data, size_t size)
+{
+	if(buffer.size() + size <= BUFFER_SIZE) {
+		buffer.append(data, size);
+		return;
+	}
+	struct iovec parts[2];
+	parts[0].iov_base = &buffer[0];
+	parts[0].iov_len = buffer.size();
+	parts[1].iov_base = const_cast<char *>(data);
+	parts[1].iov_len = size;
+	write_all(parts, 2);
+	buffer.clear();
+}
+
+bool Output::flush()
+{
+	if(!buffer.empty()) {
+		struct iovec part;
+		part.iov_base = &buffer[0];
+		part.iov_len = buffer.size();
+		write_all(&part, 1);
+		buffer.clear();
+	}
+	return !failed;
+}
+
+void Output::write_all(struct iovec * parts, int count)
+{
+	if(!failed) {
+		failed = !Html2Mark::write_all(fd, parts, count);
+	}
+}
+
+struct Settings {
+	int options;
+	size_t wrap_width;
+	size_t jobs;
+	std::string output_dir;
+	bool stats;
+	Html2Mark::Limits limits;
+	bool max_depth_given;
+	bool max_output_size_given;
+	std::string socket_path;
+	std::string cache_dir;
+	Html2Mark::ResultCache * cache;
+	Settings()
+		: options(Html2Mark::UNDERSCORED_HEADINGS | Html2Mark::MAKE_REFERENCE_LINKS),
+		wrap_width(0), jobs(1), stats(false),
+		max_depth_given(false), max_output_size_given(false), cache(nullptr)
+	{}
+};
+
+// Output file for the given input: its base name with .md extension
+// in the output directory.
+static std::string output_path(const std::string & output_dir, const std::string & filename)
+{
+	size_t slash = filename.rfind('/');
+	std::string name = slash == std::string::npos ? filename : filename.substr(slash + 1);
+	size_t dot = name.rfind('.');
+	if(dot != std::string::npos && dot > 0) {
+		name.erase(dot);
+	}
+	return output_dir + "/" + name + ".md";
+}
+
+// Loads the file into input.
+// Returns an error message, or empty string on success.
+static std::string load_file(const std::string & filename, Input & input)
+{
+	int fd = open(filename.c_str(), O_RDONLY);
+	if(fd < 0) {
+		return "Cannot open file \"" + filename + "\"!";
+	}
+	bool loaded = input.load(fd);
+	close(fd);
+	if(!loaded) {
+		return "Cannot read file \"" + filename + "\"!";
+	}
+	return std::string();
+}
+
+// Converts the input, adding stats of the conversion to total if it is given.
+template<class Destination>
+static Html2Mark::Status convert(Html2Mark::Converter & converter, const Input & input,
+		Destination & destination, Html2Mark::Stats * total)
+{
+	if(!total) {
+		return converter.convert(input.view(), destination);
+	}
+	Html2Mark::Stats stats;
+	Html2Mark::Status status = converter.convert(input.view(), destination, &stats);
+	total->add(stats);
+	return status;
+}
+
+// Converts the input and writes the result to the output file descriptor.
+// Returns false if the output could not be written.
+static bool write_converted(Html2Mark::Converter & converter, const Input & input,
+		int output_fd, Html2Mark::Stats * total, Html2Mark::Status & status)
+{
+	Output output(output_fd);
+	Html2Mark::Sink sink = [&output](const char * data, size_t size) {
+		output.write(data, size);
+	};
+	status = convert(converter, input, sink, total);
+	return output.flush();
+}
+
+static std::string too_large_error(const std::string & filename)
+{
+	return "Output of \"" + filename + "\" is too large!";
+}
+
+static void print_stats(const Html2Mark::Stats & stats)
+{
+	std::cerr
+		<< "total time: " << stats.total_time * 1000 << " ms\n"
+		<< "tokenize time: " << stats.tokenize_time * 1000 << " ms\n"
+		<< "render time: " << stats.render_time * 1000 << " ms\n"
+		<< "color time: " << stats.color_time * 1000 << " ms\n"
+		<< "wrap time: " << stats.wrap_time * 1000 << " ms\n"
+		<< "tokens: " << stats.tokens << "\n"
+		<< "elements: " << stats.elements << "\n"
+		<< "max depth: " << stats.max_depth << "\n"
+		<< "references: " << stats.references << "\n"
+		<< "input: " << stats.input_size << " bytes\n"
+		<< "output: " << stats.output_size << " bytes\n"
+		<< "peak buffer: " << stats.peak_buffer_size << " bytes" << std::endl;
+}
+
+static void print_cache_counters(const Html2Mark::CacheCounters & counters)
+{
+	std::cerr
+		<< "cache hits: " << counters.hits << " (" << counters.disk_hits << " from disk)\n"
+		<< "cache misses: " << counters.misses << "\n"
+		<< "cache evictions: " << counters.evictions << std::endl;
+}
+
+// Sums up stats that workers collected.
+static void print_stats(const std::vector<Html2Mark::Stats> & worker_stats)
+{
+	Html2Mark::Stats total;
+	for(const Html2Mark::Stats & stats : worker_stats) {
+		total.add(stats);
+	}
+	print_stats(total);
+}
+
+// Files with the same base name would be written to the same output file,
+// so they are refused before anything is converted.
+static bool has_distinct_outputs(const std::vector<std::string> & files, const std::string & output_dir)
+{
+	std::map<std::string, std::string> inputs;
+	bool distinct = true;
+	for(const std::string & filename : files) {
+		std::string path = output_path(output_dir, filename);
+		auto added = inputs.insert(std::make_pair(path, filename));
+		if(!added.second) {
+			std::cerr << "Files \"" << added.first->second << "\" and \"" << filename
+				<< "\" would both be written to \"" << path << "\"!" << std::endl;
+			distinct = false;
+		}
+	}
+	return distinct;
+}
+
+// Converts every file into its own output file in the output directory.
+static bool convert_to_directory(const std::vector<std::string> & files, const Settings & settings)
+{
+	if(!has_distinct_outputs(files, settings.output_dir)) {
+		return false;
+	}
+	Html2Mark::ThreadPool pool(settings.jobs);
+	std::vector<std::unique_ptr<Html2Mark::Converter>> converters;
+	for(size_t i = 0; i < pool.size(); ++i) {
+		converters.emplace_back(new Html2Mark::Converter(settings.options, 20, settings.wrap_width, settings.limits));
+		converters.back()->use_cache(settings.cache);
+	}
+	std::vector<Html2Mark::Stats> worker_stats(pool.size());
+	std::mutex errors_mutex;
+	bool ok = true;
+	for(const std::string & filename : files) {
+		pool.submit([&, filename](size_t worker) {
+				Input input;
+				std::string error = load_file(filename, input);
+				if(error.empty()) {
+					std::string path = output_path(settings.output_dir, filename);
+					int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+					if(fd < 0) {
+						error = "Cannot create file \"" + path + "\"!";
+					} else {
+						Html2Mark::Status status;
+						bool written = write_converted(*converters[worker], input, fd,
+								settings.stats ? &worker_stats[worker] : nullptr, status);
+						if(close(fd) != 0 || !written) {
+							error = "Cannot write file \"" + path + "\"!";
+						} else if(status == Html2Mark::OUTPUT_TOO_LARGE) {
+							error = too_large_error(filename);
+						}
+					}
+				}
+				if(!error.empty()) {
+					std::lock_guard<std::mutex> lock(errors_mutex);
+					std::cerr << error << std::endl;
+					ok = false;
+				}
+				});
+	}
+	pool.wait();
+	if(settings.stats) {
+		print_stats(worker_stats);
+	}
+	return ok;
+}
+
+// Converts files in parallel and writes results to stdout in the order of files.
+// Workers run at most a few files ahead of the writer,
+// so that memory use does not depend on the number of files.
+static bool convert_to_stdout(const std::vector<std::string> & files, const Settings & settings)
+{
+	struct Result {
+		bool done;
+		std::string text;
+		std::string error;
+		Result() : done(false) {}
+	};
+	Html2Mark::ThreadPool pool(settings.jobs);
+	std::vector<std::unique_ptr<Html2Mark::Converter>> converters;
+	for(size_t i = 0; i < pool.size(); ++i) {
+		converters.emplace_back(new Html2Mark::Converter(settings.options, 20, settings.wrap_width, settings.limits));
+		converters.back()->use_cache(settings.cache);
+	}
+	std::vector<Html2Mark::Stats> worker_stats(pool.size());
+	const size_t window = 4 * pool.size();
+	std::vector<Result> results(files.size());
+	std::mutex results_mutex;
+	std::condition_variable result_done;
+	size_t submitted = 0;
+	auto submit_next = [&]() {
+		size_t index = submitted++;
+		pool.submit([&, index](size_t worker) {
+				Result & result = results[index];
+				Input input;
+				std::string error = load_file(files[index], input);
+				if(error.empty()) {
+					Html2Mark::Status status = convert(*converters[worker], input, result.text,
+							settings.stats ? &worker_stats[worker] : nullptr);
+					if(status == Html2Mark::OUTPUT_TOO_LARGE) {
+						error = too_large_error(files[index]);
+					}
+				}
+				std::lock_guard<std::mutex> lock(results_mutex);
+				result.error = error;
+				result.done = true;
+				result_done.notify_all();
+				});
+	};
+	while(submitted < files.size() && submitted < window) {
+		submit_next();
+	}
+	Output output(STDOUT_FILENO);
+	bool ok = true;
+	for(size_t index = 0; index < files.size(); ++index) {
+		Result & result = results[index];
+		{
+			std::unique_lock<std::mutex> lock(results_mutex);
+			result_done.wait(lock, [&result]() { return result.done; });
+		}
+		if(!result.error.empty()) {
+			std::cerr << result.error << std::endl;
+			ok = false;
+		}
+		output.write(result.text.data(), result.text.size());
+		std::string().swap(result.text);
+		if(submitted < files.size()) {
+			submit_next();
+		}
+	}
+	pool.wait();
+	if(settings.stats) {
+		print_stats(worker_stats);
+	}
+	if(!output.flush()) {
+		std::cerr << "Cannot write output!" << std::endl;
+		return false;
+	}
+	return ok;
+}
+
+// Converts a single document to stdout.
+// With several jobs the document itself is converted in parallel,
+// unless stats are asked for: they are collected on one thread.
+static bool convert_single(const Input & input, const Settings & settings)
+{
+	bool ok;
+	Html2Mark::Status status;
+	if(settings.jobs > 1 && !settings.stats) {
+		Html2Mark::ParallelConverter converter(settings.jobs, settings.options, 20, settings.wrap_width,
+				64 * 1024, settings.limits);
+		converter.use_cache(settings.cache);
+		Output output(STDOUT_FILENO);
+		status = converter.convert(input.view(), [&output](const char * data, size_t size) {
+				output.write(data, size);
+				});
+		ok = output.flush();
+	} else {
+		Html2Mark::Converter converter(settings.options, 20, settings.wrap_width, settings.limits);
+		converter.use_cache(settings.cache);
+		Html2Mark::Stats stats;
+		ok = write_converted(converter, input, STDOUT_FILENO, settings.stats ? &stats : nullptr, status);
+		if(settings.stats) {
+			print_stats(stats);
+		}
+	}
+	if(!ok) {
+		std::cerr << "Cannot write output!" << std::endl;
+		return false;
+	}
+	if(status == Html2Mark::OUTPUT_TOO_LARGE) {
+		std::cerr << "Output is too large!" << std::endl;
+		return false;
+	}
+	return true;
+}
 
 int main(int argc, char ** argv)
 {
-	int options = Html2Mark::UNDERSCORED_HEADINGS | Html2Mark::MAKE_REFERENCE_LINKS;
-	size_t wrap_width = 0;
-	std::string filename;
+	Settings settings;
 
 	static struct option long_options[] = {
 		{"color", no_argument, nullptr, 'c'},
 		{"width", required_argument, nullptr, 'w'},
+		{"jobs", required_argument, nullptr, 'j'},
+		{"output-dir", required_argument, nullptr, 'o'},
+		{"stats", no_argument, nullptr, 's'},
+		{"max-depth", required_argument, nullptr, 'D'},
+		{"max-output", required_argument, nullptr, 'O'},
+		{"max-references", required_argument, nullptr, 'R'},
+		{"max-attribute-size", required_argument, nullptr, 'A'},
+		{"serve", required_argument, nullptr, 'S'},
+		{"cache-dir", required_argument, nullptr, 'C'},
 		{nullptr, 0, nullptr, 0}
 	};
 	while(true) {
 		int option_index = 0;
-		int c = getopt_long(argc, argv, "c", long_options, &option_index);
+		int c = getopt_long(argc, argv, "cj:o:", long_options, &option_index);
 		if(c == -1) {
 			break;
 		}
 		switch(c) {
-			case 'c': options |= Html2Mark::COLORS; break;
+			case 'c': settings.options |= Html2Mark::COLORS; break;
 			case 'w': {
-				wrap_width = strtoul(optarg, nullptr, 10);
-				if(wrap_width <= 0) {
+				settings.wrap_width = strtoul(optarg, nullptr, 10);
+				if(settings.wrap_width <= 0) {
 					std::cerr << "Width must be greater than 0.\n";
 					return 1;
 				}
-				options |= Html2Mark::WRAP;
+				settings.options |= Html2Mark::WRAP;
 				break;
 			}
+			case 'j': {
+				settings.jobs = strtoul(optarg, nullptr, 10);
+				if(settings.jobs <= 0) {
+					std::cerr << "Number of jobs must be greater than 0.\n";
+					return 1;
+				}
+				break;
+			}
+			case 'o': settings.output_dir = optarg; break;
+			case 's': settings.stats = true; break;
+			case 'D': {
+				settings.limits.max_depth = strtoul(optarg, nullptr, 10);
+				settings.max_depth_given = true;
+				break;
+			}
+			case 'O': {
+				settings.limits.max_output_size = strtoul(optarg, nullptr, 10);
+				settings.max_output_size_given = true;
+				break;
+			}
+			case 'R': settings.limits.max_references = strtoul(optarg, nullptr, 10); break;
+			case 'A': settings.limits.max_attribute_size = strtoul(optarg, nullptr, 10); break;
+			case 'S': settings.socket_path = optarg; break;
+			case 'C': settings.cache_dir = optarg; break;
 			case '?': break;
 			default: return 1;
 		}
 	}
-	if(optind < argc) {
-		filename = argv[optind];
+	std::vector<std::string> files(argv + optind, argv + argc);
+	std::unique_ptr<Html2Mark::ResultCache> cache;
+	if(!settings.cache_dir.empty()) {
+		cache.reset(new Html2Mark::ResultCache(64 << 20, settings.cache_dir));
+		settings.cache = cache.get();
 	}
 
-	if(!filename.empty()) {
-		std::ifstream in(filename);
-		if(in.fail()) {
-			std::cerr << "Cannot open file \"" << filename << "\"!" << std::endl;
+	bool ok;
+	if(!settings.socket_path.empty()) {
+		if(!files.empty() || !settings.output_dir.empty()) {
+			std::cerr << "Server takes documents from the socket only.\n";
 			return 1;
 		}
-		std::cout << Html2Mark::html2mark(in, options, 20, wrap_width);
+		// Documents come from anyone who can connect, so they are limited
+		// unless the limits are given, zero for no limit included.
+		if(!settings.max_depth_given) {
+			settings.limits.max_depth = SERVER_MAX_DEPTH;
+		}
+		if(!settings.max_output_size_given) {
+			settings.limits.max_output_size = SERVER_MAX_OUTPUT_SIZE;
+		}
+		ok = serve(settings.socket_path, settings.jobs, settings.limits, settings.cache);
+	} else if(!settings.output_dir.empty()) {
+		if(files.empty()) {
+			std::cerr << "Output directory needs input files.\n";
+			return 1;
+		}
+		ok = convert_to_directory(files, settings);
+	} else if(files.empty()) {
+		Input input;
+		ok = input.load(STDIN_FILENO);
+		if(ok) {
+			ok = convert_single(input, settings);
+		} else {
+			std::cerr << "Cannot read input!" << std::endl;
+		}
+	} else if(files.size() == 1) {
+		Input input;
+		std::string error = load_file(files[0], input);
+		if(error.empty()) {
+			ok = convert_single(input, settings);
+		} else {
+			std::cerr << error << std::endl;
+			ok = false;
+		}
 	} else {
-		std::cout << Html2Mark::html2mark(std::cin, options, 20, wrap_width);
+		ok = convert_to_stdout(files, settings);
+	}
+	if(settings.stats && settings.cache) {
+		print_cache_counters(settings.cache->counters());
 	}
-	return 0;
+	return ok ? 0 : 1;
 }
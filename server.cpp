@@ -0,0 +1,398 @@
+#include "server.h"
+#include "src/protocol.h"
+#include "src/result_cache.h"
+#include "src/thread_pool.h"
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <tuple>
+#include <vector>
+
+typedef std::chrono::steady_clock Clock;
+
+static const uint32_t KNOWN_OPTIONS = Html2Mark::UNDERSCORED_HEADINGS
+	| Html2Mark::MAKE_REFERENCE_LINKS | Html2Mark::COLORS | Html2Mark::WRAP;
+// Time a client has to send a whole request, and then to take the whole response,
+// so that a slow client does not keep a worker for long.
+static const int IO_TIMEOUT_SECONDS = 10;
+
+// Write end of the pipe that wakes the server loop, and whether it should stop.
+static int wake_fd = -1;
+static volatile sig_atomic_t stop_requested = 0;
+
+static void wake_up()
+{
+	char byte = 0;
+	ssize_t written = write(wake_fd, &byte, 1);
+	(void)written;
+}
+
+static void on_stop_signal(int)
+{
+	stop_requested = 1;
+	wake_up();
+}
+
+// Counters of the server and latencies of the latest requests,
+// from the moment a request could be read up to the moment its response was written.
+class ServerStats {
+public:
+	explicit ServerStats(Html2Mark::ResultCache * result_cache);
+	void add_connection();
+	void add_request(double seconds, bool failed);
+	void set_queue_depth(size_t depth);
+	std::string json();
+private:
+	static const size_t LATENCY_COUNT = 4096;
+	std::mutex mutex;
+	std::vector<double> latencies;
+	size_t next_latency;
+	size_t connections;
+	size_t requests;
+	size_t failed_requests;
+	size_t queue_depth;
+	size_t max_queue_depth;
+	Html2Mark::ResultCache * cache;
+};
+
+ServerStats::ServerStats(Html2Mark::ResultCache * result_cache)
+	: next_latency(0), connections(0), requests(0), failed_requests(0),
+	queue_depth(0), max_queue_depth(0), cache(result_cache)
+{}
+
+void ServerStats::add_connection()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	++connections;
+}
+
+void ServerStats::add_request(double seconds, bool failed)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	++requests;
+	failed_requests += failed;
+	if(latencies.size() < LATENCY_COUNT) {
+		latencies.push_back(seconds);
+	} else {
+		latencies[next_latency] = seconds;
+		next_latency = (next_latency + 1) % LATENCY_COUNT;
+	}
+}
+
+void ServerStats::set_queue_depth(size_t depth)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	queue_depth = depth;
+	max_queue_depth = std::max(max_queue_depth, depth);
+}
+
+static double percentile(std::vector<double> & values, size_t percent)
+{
+	if(values.empty()) {
+		return 0;
+	}
+	size_t index = std::min(values.size() - 1, values.size() * percent / 100);
+	std::nth_element(values.begin(), values.begin() + long(index), values.end());
+	return values[index];
+}
+
+std::string ServerStats::json()
+{
+	std::vector<double> sorted;
+	std::ostringstream out;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		sorted = latencies;
+		out << "{\"connections\": " << connections
+			<< ", \"requests\": " << requests
+			<< ", \"failed_requests\": " << failed_requests
+			<< ", \"queue_depth\": " << queue_depth
+			<< ", \"max_queue_depth\": " << max_queue_depth;
+	}
+	out << ", \"latency_ms\": {"
+		<< "\"p50\": " << percentile(sorted, 50) * 1000
+		<< ", \"p90\": " << percentile(sorted, 90) * 1000
+		<< ", \"p99\": " << percentile(sorted, 99) * 1000
+		<< ", \"max\": " << percentile(sorted, 100) * 1000 << "}";
+	if(cache) {
+		Html2Mark::CacheCounters counters = cache->counters();
+		out << ", \"cache\": {\"hits\": " << counters.hits
+			<< ", \"disk_hits\": " << counters.disk_hits
+			<< ", \"misses\": " << counters.misses
+			<< ", \"evictions\": " << counters.evictions
+			<< ", \"entries\": " << counters.entries
+			<< ", \"memory_size\": " << counters.memory_size << "}";
+	}
+	out << "}";
+	return out.str();
+}
+
+// Buffers and converters of a worker thread, one converter
+// for each combination of options and wrap width that was asked for.
+struct Worker {
+	std::map<std::tuple<uint32_t, uint32_t, uint32_t>, std::unique_ptr<Html2Mark::Converter>> converters;
+	std::string html;
+	std::string markdown;
+};
+
+// Idle connections are polled by the main thread. A connection
+// that has a request is handed to the pool; the worker reads the request,
+// writes the response and gives the connection back to be polled again.
+class Server {
+public:
+	Server(size_t jobs, const Html2Mark::Limits & server_limits, Html2Mark::ResultCache * result_cache);
+	~Server();
+	bool listen(const std::string & path);
+	void run();
+private:
+	Html2Mark::ThreadPool pool;
+	const Html2Mark::Limits limits;
+	Html2Mark::ResultCache * cache;
+	std::vector<Worker> workers;
+	ServerStats stats;
+	std::string socket_path;
+	int listener;
+	int wake_pipe[2];
+	std::mutex mutex;
+	std::vector<int> returned; // Connections given back by workers.
+	size_t queued;
+
+	void submit(int connection);
+	bool handle(int connection, Worker & worker, Clock::time_point ready);
+	Html2Mark::Converter & converter(Worker & worker, const Html2Mark::RequestHeader & header);
+	void give_back(int connection);
+};
+
+Server::Server(size_t jobs, const Html2Mark::Limits & server_limits, Html2Mark::ResultCache * result_cache)
+	: pool(jobs), limits(server_limits), cache(result_cache), workers(pool.size()),
+	stats(result_cache), listener(-1), queued(0)
+{
+	wake_pipe[0] = wake_pipe[1] = -1;
+}
+
+Server::~Server()
+{
+	pool.wait();
+	for(int connection : returned) {
+		close(connection);
+	}
+	if(listener >= 0) {
+		close(listener);
+		unlink(socket_path.c_str());
+	}
+	if(wake_pipe[0] >= 0) {
+		close(wake_pipe[0]);
+		close(wake_pipe[1]);
+	}
+}
+
+bool Server::listen(const std::string & path)
+{
+	sockaddr_un address;
+	memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	if(path.size() >= sizeof(address.sun_path)) {
+		std::cerr << "Socket path \"" << path << "\" is too long!" << std::endl;
+		return false;
+	}
+	memcpy(address.sun_path, path.data(), path.size());
+	// Socket left by a server that did not stop cleanly.
+	struct stat info;
+	if(lstat(path.c_str(), &info) == 0 && S_ISSOCK(info.st_mode)) {
+		unlink(path.c_str());
+	}
+	listener = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC | SOCK_NONBLOCK, 0);
+	if(listener < 0 || bind(listener, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0) {
+		std::cerr << "Cannot create socket \"" << path << "\"!" << std::endl;
+		return false;
+	}
+	socket_path = path;
+	if(::listen(listener, SOMAXCONN) != 0 || pipe2(wake_pipe, O_CLOEXEC | O_NONBLOCK) != 0) {
+		std::cerr << "Cannot listen on socket \"" << path << "\"!" << std::endl;
+		return false;
+	}
+	wake_fd = wake_pipe[1];
+	return true;
+}
+
+void Server::give_back(int connection)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		returned.push_back(connection);
+	}
+	wake_up();
+}
+
+void Server::submit(int connection)
+{
+	Clock::time_point ready = Clock::now();
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stats.set_queue_depth(++queued);
+	}
+	pool.submit([this, connection, ready](size_t worker) {
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				stats.set_queue_depth(--queued);
+			}
+			// A request that fails to be served (e.g. memory is out)
+			// loses only its connection, the server goes on.
+			bool keeps_connection = false;
+			try {
+				keeps_connection = handle(connection, workers[worker], ready);
+			} catch(const std::exception &) {
+				stats.add_request(std::chrono::duration<double>(Clock::now() - ready).count(), true);
+			}
+			if(keeps_connection) {
+				give_back(connection);
+			} else {
+				close(connection);
+			}
+			});
+}
+
+Html2Mark::Converter & Server::converter(Worker & worker, const Html2Mark::RequestHeader & header)
+{
+	std::tuple<uint32_t, uint32_t, uint32_t> key(header.options, header.wrap_width,
+			header.min_reference_links_length);
+	auto found = worker.converters.find(key);
+	if(found != worker.converters.end()) {
+		return *found->second;
+	}
+	// Clients that keep changing settings do not make converters pile up.
+	if(worker.converters.size() >= 16) {
+		worker.converters.clear();
+	}
+	Html2Mark::Converter * converter = new Html2Mark::Converter(int(header.options),
+			header.min_reference_links_length, header.wrap_width, limits);
+	converter->use_cache(cache);
+	worker.converters[key].reset(converter);
+	return *converter;
+}
+
+// Returns false when the connection should be closed.
+bool Server::handle(int connection, Worker & worker, Clock::time_point ready)
+{
+	Html2Mark::Deadline deadline = Clock::now() + std::chrono::seconds(IO_TIMEOUT_SECONDS);
+	Html2Mark::RequestHeader header;
+	if(!Html2Mark::read_header(connection, header, &deadline)) {
+		return false;
+	}
+	Html2Mark::ResponseHeader response;
+	response.status = Html2Mark::RESPONSE_BAD_REQUEST;
+	response.size = 0;
+	if(header.size > Html2Mark::MAX_REQUEST_SIZE) {
+		Html2Mark::write_message(connection, response, Html2Mark::StringView(), &deadline);
+		stats.add_request(std::chrono::duration<double>(Clock::now() - ready).count(), true);
+		return false;
+	}
+	if(!Html2Mark::read_body(connection, header.size, worker.html, &deadline)) {
+		return false;
+	}
+	bool valid_options = (header.options & ~KNOWN_OPTIONS) == 0
+		&& ((header.options & Html2Mark::WRAP) == 0 || header.wrap_width > 0);
+	worker.markdown.clear();
+	if(header.kind == Html2Mark::STATS_REQUEST) {
+		worker.markdown = stats.json();
+		response.status = Html2Mark::RESPONSE_CONVERTED;
+	} else if(header.kind == Html2Mark::CONVERT_REQUEST && valid_options) {
+		Html2Mark::Status status = converter(worker, header).convert(worker.html, worker.markdown);
+		response.status = status == Html2Mark::CONVERTED
+			? Html2Mark::RESPONSE_CONVERTED : Html2Mark::RESPONSE_TOO_LARGE;
+		if(worker.markdown.size() > Html2Mark::MAX_BODY_SIZE) {
+			worker.markdown.clear();
+			response.status = Html2Mark::RESPONSE_TOO_LARGE;
+		}
+	}
+	deadline = Clock::now() + std::chrono::seconds(IO_TIMEOUT_SECONDS);
+	bool written = Html2Mark::write_message(connection, response, worker.markdown, &deadline);
+	stats.add_request(std::chrono::duration<double>(Clock::now() - ready).count(),
+			response.status == Html2Mark::RESPONSE_BAD_REQUEST);
+	return written;
+}
+
+static pollfd poll_for_input(int fd)
+{
+	pollfd item;
+	item.fd = fd;
+	item.events = POLLIN;
+	item.revents = 0;
+	return item;
+}
+
+void Server::run()
+{
+	std::vector<int> idle;
+	std::vector<pollfd> items;
+	while(!stop_requested) {
+		items.clear();
+		items.push_back(poll_for_input(wake_pipe[0]));
+		items.push_back(poll_for_input(listener));
+		for(int connection : idle) {
+			items.push_back(poll_for_input(connection));
+		}
+		if(poll(items.data(), items.size(), -1) < 0) {
+			continue;
+		}
+		idle.clear();
+		for(size_t i = 2; i < items.size(); ++i) {
+			if(items[i].revents != 0) {
+				submit(items[i].fd);
+			} else {
+				idle.push_back(items[i].fd);
+			}
+		}
+		if(items[0].revents != 0) {
+			char buffer[256];
+			while(read(wake_pipe[0], buffer, sizeof(buffer)) > 0) {
+			}
+			std::lock_guard<std::mutex> lock(mutex);
+			idle.insert(idle.end(), returned.begin(), returned.end());
+			returned.clear();
+		}
+		if(items[1].revents != 0) {
+			int connection;
+			// Connections do not block, so that reading and writing
+			// can be given up at the deadline of the request.
+			while((connection = accept4(listener, nullptr, nullptr, SOCK_CLOEXEC | SOCK_NONBLOCK)) >= 0) {
+				idle.push_back(connection);
+				stats.add_connection();
+			}
+		}
+	}
+	pool.wait();
+	for(int connection : idle) {
+		close(connection);
+	}
+	std::cerr << stats.json() << std::endl;
+}
+
+bool serve(const std::string & socket_path, size_t jobs, const Html2Mark::Limits & limits,
+		Html2Mark::ResultCache * cache)
+{
+	Server server(jobs, limits, cache);
+	if(!server.listen(socket_path)) {
+		return false;
+	}
+	struct sigaction action;
+	memset(&action, 0, sizeof(action));
+	action.sa_handler = on_stop_signal;
+	sigaction(SIGINT, &action, nullptr);
+	sigaction(SIGTERM, &action, nullptr);
+	signal(SIGPIPE, SIG_IGN);
+	server.run();
+	return true;
+}
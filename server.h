@@ -0,0 +1,15 @@
+#pragma once
+#include "src/html2mark.h"
+#include <string>
+
+// Limits of the server where none are given on the command line:
+// a request of MAX_REQUEST_SIZE cannot make it nest or write without end.
+const size_t SERVER_MAX_DEPTH = 512;
+const size_t SERVER_MAX_OUTPUT_SIZE = 256 << 20;
+
+// Serves conversion requests (see src/protocol.h) on a Unix domain socket
+// until SIGINT or SIGTERM, converting them on jobs threads.
+// Results are looked up in the cache first if it is given.
+// Returns false if the socket cannot be set up.
+bool serve(const std::string & socket_path, size_t jobs, const Html2Mark::Limits & limits,
+		Html2Mark::ResultCache * cache = nullptr);
@@ -0,0 +1,50 @@
+#include "arena.h"
+#include <cstring>
+
+namespace Html2Mark {
+
+Arena::Arena(size_t min_block_size)
+	: block_size(min_block_size), current(0), used(0)
+{}
+
+char * Arena::allocate(size_t size)
+{
+	while(current < blocks.size()) {
+		if(used + size <= blocks[current].size) {
+			char * result = blocks[current].data.get() + used;
+			used += size;
+			return result;
+		}
+		++current;
+		used = 0;
+	}
+	while(block_size < size) {
+		block_size *= 2;
+	}
+	Block block;
+	block.data.reset(new char[block_size]);
+	block.size = block_size;
+	blocks.push_back(std::move(block));
+	block_size *= 2;
+	current = blocks.size() - 1;
+	used = size;
+	return blocks[current].data.get();
+}
+
+StringView Arena::copy(const StringView & text)
+{
+	if(text.empty()) {
+		return StringView();
+	}
+	char * data = allocate(text.size());
+	memcpy(data, text.data(), text.size());
+	return StringView(data, text.size());
+}
+
+void Arena::reset()
+{
+	current = 0;
+	used = 0;
+}
+
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include "string_view.h"
+#include <memory>
+#include <vector>
+
+namespace Html2Mark {
+
+// Bump allocator for data that lives until the end of a conversion.
+// reset() makes the memory available again but keeps the blocks,
+// so converting similar documents one after another does not touch the heap.
+class Arena {
+public:
+	Arena(size_t min_block_size = 4096);
+	char * allocate(size_t size);
+	StringView copy(const StringView & text);
+	void reset();
+private:
+	struct Block {
+		std::unique_ptr<char[]> data;
+		size_t size;
+	};
+	std::vector<Block> blocks;
+	size_t block_size;
+	size_t current;
+	size_t used;
+};
+
+}
@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+# Generates char_widths.cpp: columns that characters take in a terminal,
+# from the Unicode database of Python (East Asian Width and categories).
+# Usage: python3 char_widths.py > char_widths.cpp
+import unicodedata
+
+BLOCK_SIZE = 256
+CODE_COUNT = 0x110000
+
+# Ideograph ranges that are wide even where no character is assigned yet.
+WIDE_RANGES = [(0x3400, 0x4dbf), (0x4e00, 0x9fff), (0xf900, 0xfaff),
+	(0x20000, 0x2fffd), (0x30000, 0x3fffd)]
+
+
+def width(code):
+	if code < 0x80:
+		return 1
+	char = chr(code)
+	category = unicodedata.category(char)
+	# Soft hyphen is shown where the line is broken, so it takes a column.
+	if code == 0xad:
+		return 1
+	# Combining marks, format characters, C1 controls and medial
+	# and final Hangul jamo are drawn over or joined to the previous one.
+	if category in ('Mn', 'Me', 'Cf', 'Cc') or 0x1160 <= code <= 0x11ff:
+		return 0
+	if unicodedata.east_asian_width(char) in ('W', 'F'):
+		return 2
+	if any(first <= code <= last for first, last in WIDE_RANGES):
+		return 2
+	return 1
+
+
+def main():
+	# Two-stage table: blocks of 256 widths packed by four into bytes,
+	# equal blocks are stored once.
+	blocks = []
+	block_index = {}
+	stage1 = []
+	for start in range(0, CODE_COUNT, BLOCK_SIZE):
+		packed = bytearray(BLOCK_SIZE // 4)
+		for code in range(start, start + BLOCK_SIZE):
+			offset = code - start
+			packed[offset // 4] |= width(code) << (offset % 4 * 2)
+		packed = bytes(packed)
+		if packed not in block_index:
+			block_index[packed] = len(blocks)
+			blocks.append(packed)
+		stage1.append(block_index[packed])
+	assert len(blocks) <= 256
+
+	print('// Generated by char_widths.py (Unicode %s), do not edit.' % unicodedata.unidata_version)
+	print('#include "display_width.h"')
+	print('#include <cstdint>')
+	print()
+	print('namespace Html2Mark {')
+	print()
+	print('namespace {')
+	print('\t// Block of every 256 code points.')
+	print('\tconst uint8_t BLOCKS[%d] = {' % len(stage1))
+	for start in range(0, len(stage1), 24):
+		print('\t\t' + ' '.join('%d,' % b for b in stage1[start:start + 24]))
+	print('\t};')
+	print('\t// Widths of code points in blocks, two bits each.')
+	print('\tconst uint8_t WIDTHS[%d][%d] = {' % (len(blocks), BLOCK_SIZE // 4))
+	for block in blocks:
+		print('\t\t{')
+		for start in range(0, len(block), 16):
+			print('\t\t\t' + ' '.join('0x%02x,' % b for b in block[start:start + 16]))
+		print('\t\t},')
+	print('\t};')
+	print('}')
+	print('''
+unsigned char_width(unsigned code)
+{
+	if(code >= 0x110000) {
+		return 1;
+	}
+	unsigned packed = WIDTHS[BLOCKS[code >> 8]][(code & 0xff) >> 2];
+	return (packed >> ((code & 3) * 2)) & 3;
+}
+
+}''')
+
+
+if __name__ == '__main__':
+	main()
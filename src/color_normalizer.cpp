@@ -0,0 +1,91 @@
+#include "color_normalizer.h"
+#include "escape_sequence.h"
+#include <cstring>
+
+namespace Html2Mark {
+
+ColorNormalizer::ColorNormalizer()
+	: ends_with_reset(false)
+{}
+
+void ColorNormalizer::start(std::string & out)
+{
+	out += RESET_SEQUENCE;
+	ends_with_reset = true;
+}
+
+void ColorNormalizer::write_pending(std::string & out)
+{
+	if(!pending.empty()) {
+		out += pending;
+		ends_with_reset = is_reset_sequence(pending.data(), pending.size());
+		pending.clear();
+	}
+}
+
+void ColorNormalizer::process(const char * data, size_t size, std::string & out)
+{
+	if(partial.empty()) {
+		scan(data, size, out);
+		return;
+	}
+	std::string text;
+	text.swap(partial);
+	text.append(data, size);
+	scan(text.data(), text.size(), out);
+}
+
+void ColorNormalizer::scan(const char * data, size_t size, std::string & out)
+{
+	const char * pos = data;
+	const char * end = data + size;
+	while(pos < end) {
+		const char * escape = static_cast<const char *>(memchr(pos, ESCAPE_CHAR, size_t(end - pos)));
+		if(escape == nullptr) {
+			escape = end;
+		}
+		if(escape > pos) {
+			write_pending(out);
+			out.append(pos, escape);
+			ends_with_reset = false;
+		}
+		if(escape == end) {
+			break;
+		}
+		size_t length = escape_sequence_size(escape, end);
+		if(length == 0) {
+			partial.assign(escape, end);
+			break;
+		}
+		pos = escape + length;
+		if(!is_reset_sequence(escape, length)) {
+			color_stack.push_back(std::string(escape, length));
+			pending = color_stack.back();
+		} else if(!color_stack.empty()) {
+			color_stack.pop_back();
+			if(color_stack.empty()) {
+				pending.assign(RESET_SEQUENCE, RESET_SEQUENCE_SIZE);
+			} else {
+				pending = color_stack.back();
+			}
+		}
+	}
+}
+
+void ColorNormalizer::finish(std::string & out)
+{
+	if(!partial.empty()) {
+		write_pending(out);
+		out += partial;
+		partial.clear();
+		ends_with_reset = false;
+	}
+	write_pending(out);
+	if(!ends_with_reset) {
+		out += RESET_SEQUENCE;
+		ends_with_reset = true;
+	}
+	color_stack.clear();
+}
+
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <string>
+#include <vector>
+
+namespace Html2Mark {
+
+// Rebalances color sequences: each RESET restores the color that was
+// in effect before the closed one, RESET without an open color is dropped,
+// and sequences that are immediately overridden by the next one are dropped.
+//
+// Text is read once and written to a separate output buffer.
+// It may be fed in chunks of any size; the last escape sequence
+// is held back until the next character shows whether it is overridden.
+class ColorNormalizer {
+public:
+	ColorNormalizer();
+	void start(std::string & out);
+	void process(const char * data, size_t size, std::string & out);
+	void finish(std::string & out);
+private:
+	std::vector<std::string> color_stack;
+	std::string pending;
+	std::string partial;
+	bool ends_with_reset;
+
+	void scan(const char * data, size_t size, std::string & out);
+	void write_pending(std::string & out);
+};
+
+}
@@ -0,0 +1,142 @@
+#include "display_width.h"
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace Html2Mark {
+
+static size_t utf8_sequence_size(unsigned char lead)
+{
+	if(lead < 0xc0) {
+		return 1;
+	} else if(lead < 0xe0) {
+		return 2;
+	} else if(lead < 0xf0) {
+		return 3;
+	}
+	return 4;
+}
+
+static bool is_continuation(char byte)
+{
+	return (static_cast<unsigned char>(byte) & 0xc0) == 0x80;
+}
+
+size_t utf8_char_size(const char * data, size_t size)
+{
+	size_t full_size = utf8_sequence_size(static_cast<unsigned char>(data[0]));
+	size_t char_size = 1;
+	while(char_size < full_size && char_size < size && is_continuation(data[char_size])) {
+		++char_size;
+	}
+	if(char_size < full_size && char_size == size) {
+		return 0;
+	}
+	return char_size;
+}
+
+// Bytes missing from malformed characters are taken as zero bits,
+// so that they still get some width.
+unsigned utf8_char_width(const char * data, size_t size)
+{
+	unsigned char lead = static_cast<unsigned char>(data[0]);
+	if(lead < 0x80) {
+		return 1;
+	} else if(lead < 0xc0) {
+		return 0;
+	}
+	size_t full_size = utf8_sequence_size(lead);
+	unsigned code = lead & (0x7fu >> full_size);
+	for(size_t i = 1; i < full_size; ++i) {
+		code <<= 6;
+		if(i < size) {
+			code |= static_cast<unsigned char>(data[i]) & 0x3fu;
+		}
+	}
+	return char_width(code);
+}
+
+#if defined(__SSE2__)
+// Width of 16 bytes that hold only ASCII characters from min_ascii on,
+// continuation bytes and first bytes of U+5000-U+9FFF, which are all
+// wide ideographs; -1 if there are other bytes. Most of CJK text and
+// of ASCII text is measured this way.
+static int chunk_width(const char * pos, char min_ascii)
+{
+	__m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pos));
+	__m128i ascii = _mm_cmpgt_epi8(chunk, _mm_set1_epi8(char(min_ascii - 1)));
+	__m128i continuation = _mm_cmplt_epi8(chunk, _mm_set1_epi8(char(0xc0)));
+	__m128i wide = _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8(char(0xe4))),
+			_mm_cmplt_epi8(chunk, _mm_set1_epi8(char(0xea))));
+	__m128i known = _mm_or_si128(_mm_or_si128(ascii, continuation), wide);
+	if(_mm_movemask_epi8(known) != 0xffff) {
+		return -1;
+	}
+	return __builtin_popcount(unsigned(_mm_movemask_epi8(ascii)))
+		+ 2 * __builtin_popcount(unsigned(_mm_movemask_epi8(wide)));
+}
+#endif
+
+size_t display_width(const char * data, size_t size)
+{
+	const char * pos = data;
+	const char * end = data + size;
+	size_t width = 0;
+	while(pos < end) {
+#if defined(__SSE2__)
+		if(end - pos >= 16) {
+			int chunk = chunk_width(pos, 0);
+			if(chunk >= 0) {
+				width += size_t(chunk);
+				pos += 16;
+				continue;
+			}
+		}
+#endif
+		size_t char_size = utf8_char_size(pos, size_t(end - pos));
+		if(char_size == 0) {
+			char_size = size_t(end - pos);
+		}
+		width += utf8_char_width(pos, char_size);
+		pos += char_size;
+	}
+	return width;
+}
+
+size_t fit_width(const char * data, size_t size, size_t max_width, size_t & width)
+{
+	const char * pos = data;
+	const char * end = data + size;
+	size_t fitted = 0;
+	while(pos < end) {
+#if defined(__SSE2__)
+		// Characters that start in the chunk have to end in the text.
+		if(end - pos >= 16 + 3 && max_width - fitted >= 32) {
+			int chunk = chunk_width(pos, '!');
+			if(chunk >= 0) {
+				fitted += size_t(chunk);
+				pos += 16;
+				continue;
+			}
+		}
+#endif
+		unsigned char byte = static_cast<unsigned char>(*pos);
+		if(byte <= ' ') {
+			break;
+		}
+		size_t char_size = utf8_char_size(pos, size_t(end - pos));
+		if(char_size == 0) {
+			break;
+		}
+		size_t char_columns = utf8_char_width(pos, char_size);
+		if(fitted + char_columns > max_width) {
+			break;
+		}
+		fitted += char_columns;
+		pos += char_size;
+	}
+	width += fitted;
+	return size_t(pos - data);
+}
+
+}
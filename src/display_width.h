@@ -0,0 +1,30 @@
+#pragma once
+#include <cstddef>
+
+namespace Html2Mark {
+
+// Columns that a character takes in a terminal: two for East Asian wide
+// and fullwidth characters, none for combining marks and other characters
+// that are drawn together with the previous one, one for the rest.
+// All ASCII characters take one column, tabs and controls are left to callers.
+unsigned char_width(unsigned code);
+
+// Size of the UTF-8 character at the start of text: the first byte
+// and the continuation bytes after it, as many as the first byte asks for.
+// Zero if the text ends before the character does.
+// Stray continuation bytes are characters of their own.
+size_t utf8_char_size(const char * data, size_t size);
+
+// Width of the UTF-8 character of the given size (see utf8_char_size()).
+// Stray continuation bytes take no room.
+unsigned utf8_char_width(const char * data, size_t size);
+
+// Columns that UTF-8 text takes.
+size_t display_width(const char * data, size_t size);
+
+// Measures the longest start of UTF-8 text that has no spaces or control
+// characters and fits into max_width columns, without the last character
+// if it is cut short. Returns its size and adds its columns to width.
+size_t fit_width(const char * data, size_t size, size_t max_width, size_t & width);
+
+}
@@ -0,0 +1,28 @@
+#include "escape_sequence.h"
+#include <cstring>
+
+namespace Html2Mark {
+
+size_t escape_sequence_size(const char * begin, const char * end)
+{
+	const char * p = begin + 1;
+	if(p == end) {
+		return 0;
+	}
+	if(*p != '[') {
+		return 2;
+	}
+	for(++p; p < end; ++p) {
+		if(*p >= 0x40 && *p <= 0x7e) {
+			return size_t(p - begin) + 1;
+		}
+	}
+	return 0;
+}
+
+bool is_reset_sequence(const char * sequence, size_t size)
+{
+	return size == RESET_SEQUENCE_SIZE && memcmp(sequence, RESET_SEQUENCE, size) == 0;
+}
+
+}
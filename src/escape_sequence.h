@@ -0,0 +1,16 @@
+#pragma once
+#include <string>
+
+namespace Html2Mark {
+
+const char ESCAPE_CHAR = '\x1b';
+const char RESET_SEQUENCE[] = "\x1b[0m";
+const size_t RESET_SEQUENCE_SIZE = sizeof(RESET_SEQUENCE) - 1;
+
+// Size of the escape sequence at the beginning of text,
+// or zero if the text ends before the sequence does.
+size_t escape_sequence_size(const char * begin, const char * end);
+
+bool is_reset_sequence(const char * sequence, size_t size);
+
+}
@@ -1,10 +1,19 @@
 #include "html2mark.h"
-#include <chthon2/xmlreader.h>
-#include <chthon2/log.h>
-#include <chthon2/util.h>
-#include <sstream>
+#include "tokenizer.h"
+#include "tags.h"
+#include "arena.h"
+#include "reference_index.h"
+#include "line_wrapper.h"
+#include "display_width.h"
+#include "color_normalizer.h"
+#include "thread_pool.h"
+#include "result_cache.h"
+#include <chrono>
 #include <vector>
+#include <algorithm>
+#include <iterator>
 #include <cctype>
+#include <cstring>
 
 namespace Html2Mark {
 
@@ -26,498 +35,2058 @@ namespace {
 	const std::string GREEN = ESCAPE_STR"[00;32m";
 }
 
-static size_t utf8_size(const std::string & s)
+typedef std::chrono::steady_clock Clock;
+
+// Adds time passed since start to the counter and restarts from now.
+static void lap(Clock::time_point & start, double & counter)
+{
+	Clock::time_point now = Clock::now();
+	counter += std::chrono::duration<double>(now - start).count();
+	start = now;
+}
+
+Limits::Limits()
+	: max_depth(0), max_output_size(0), max_references(0), max_attribute_size(0)
+{}
+
+Stats::Stats()
+	: total_time(0), tokenize_time(0), render_time(0), color_time(0), wrap_time(0),
+	tokens(0), elements(0), max_depth(0), references(0),
+	input_size(0), output_size(0), peak_buffer_size(0)
+{}
+
+void Stats::add(const Stats & other)
+{
+	total_time += other.total_time;
+	tokenize_time += other.tokenize_time;
+	render_time += other.render_time;
+	color_time += other.color_time;
+	wrap_time += other.wrap_time;
+	tokens += other.tokens;
+	elements += other.elements;
+	max_depth = std::max(max_depth, other.max_depth);
+	references += other.references;
+	input_size += other.input_size;
+	output_size += other.output_size;
+	peak_buffer_size = std::max(peak_buffer_size, other.peak_buffer_size);
+}
+
+// Values of the attributes that are used for conversion, indexed by name.
+struct Attributes {
+	StringView values[ATTR_COUNT];
+	unsigned present;
+
+	Attributes() : present(0) {}
+	bool has(AttributeName name) const { return present & (1u << name); }
+	const StringView & get(AttributeName name) const { return values[name]; }
+	void set(AttributeName name, const StringView & value);
+	void clear();
+};
+
+void Attributes::set(AttributeName name, const StringView & value)
+{
+	values[name] = value;
+	present |= 1u << name;
+}
+
+void Attributes::clear()
+{
+	std::fill(values, values + ATTR_COUNT, StringView());
+	present = 0;
+}
+
+// Open element. Its output is the tail of the shared output buffer:
+// the prefix starts at prefix_start, the content at start,
+// and everything up to the end of the buffer belongs to it.
+struct TaggedContent {
+	Tag tag;
+	StringView name;
+	Attributes attrs;
+	size_t prefix_start;
+	size_t start;
+
+	TaggedContent() : tag(UNKNOWN_TAG), prefix_start(0), start(0) {}
+};
+
+// Stack whose popped slots are not destroyed, so that pushing
+// does not allocate once the stack has been that deep,
+// and buffers in the slots keep their capacity.
+template<class T>
+class SlotStack {
+public:
+	SlotStack() : depth(0) {}
+	T & push()
+	{
+		if(depth == slots.size()) {
+			slots.emplace_back();
+		}
+		return slots[depth++];
+	}
+	// The reference stays valid until the next push.
+	T & pop() { return slots[--depth]; }
+	T & back() { return slots[depth - 1]; }
+	const T & operator[](size_t index) const { return slots[index]; }
+	bool empty() const { return depth == 0; }
+	size_t size() const { return depth; }
+	void clear() { depth = 0; }
+private:
+	std::vector<T> slots;
+	size_t depth;
+};
+
+// Unknown tags are told apart by name.
+static bool is_same_tag(const TaggedContent & value, Tag tag, const StringView & name)
+{
+	return value.tag == tag && (tag != UNKNOWN_TAG || equal_ignore_case(value.name, name));
+}
+
+static bool is_space(char ch)
+{
+	return ch == ' ' || ch == '\n' || ch == '\t' || ch == '\r' || ch == '\f' || ch == '\v';
+}
+
+// Whether content of the element is dropped when it is closed.
+static bool is_hidden(Tag tag)
+{
+	return tag == TAG_HEAD || tag == TAG_SCRIPT || tag == TAG_STYLE;
+}
+
+static bool starts_with_h(const StringView & name)
+{
+	return !name.empty() && (name[0] == 'h' || name[0] == 'H');
+}
+
+// Items of a list are kept one after another in a single buffer
+// until the list is closed.
+struct List {
+	bool numbered;
+	std::string items;
+	std::vector<size_t> item_ends;
+	unsigned open_items;
+	List() : numbered(false), open_items(0) {}
+	void start(bool numbered_list);
+};
+
+void List::start(bool numbered_list)
+{
+	numbered = numbered_list;
+	items.clear();
+	item_ends.clear();
+	open_items = 0;
+}
+
+// Calls handler(begin, end) for every line of the text.
+// Newline at the very end of the text does not start another line.
+template<class Handler>
+static void for_each_line(const char * begin, const char * end, Handler handler)
+{
+	while(begin < end) {
+		const char * eol = static_cast<const char *>(memchr(begin, '\n', size_t(end - begin)));
+		if(eol == nullptr) {
+			eol = end;
+		}
+		handler(begin, eol);
+		begin = eol + 1;
+	}
+}
+
+// Number of open elements of each kind, kept up to date on push and pop,
+// so that context checks take constant time whatever the nesting depth.
+// Unknown tags are counted by hash of their name: zero count means
+// that no such tag is open, otherwise the stack has to be looked through.
+struct OpenTags {
+	OpenTags();
+	void add(const TaggedContent & value, int delta);
+	bool has(Tag tag) const { return counts[tag] > 0; }
+	bool has_heading() const;
+	bool has_hidden() const;
+	bool may_have_unknown(const StringView & name) const;
+private:
+	enum { UNKNOWN_BUCKETS = 64 };
+	unsigned counts[TAG_COUNT];
+	unsigned unknown_counts[UNKNOWN_BUCKETS];
+
+	static unsigned bucket(const StringView & name);
+};
+
+OpenTags::OpenTags()
+{
+	std::fill(counts, counts + TAG_COUNT, 0);
+	std::fill(unknown_counts, unknown_counts + UNKNOWN_BUCKETS, 0);
+}
+
+unsigned OpenTags::bucket(const StringView & name)
+{
+	unsigned hash = 2166136261u;
+	for(char c : name) {
+		hash = (hash ^ unsigned(c | 0x20)) * 16777619u;
+	}
+	return hash % UNKNOWN_BUCKETS;
+}
+
+void OpenTags::add(const TaggedContent & value, int delta)
+{
+	counts[value.tag] += unsigned(delta);
+	if(value.tag == UNKNOWN_TAG) {
+		unknown_counts[bucket(value.name)] += unsigned(delta);
+	}
+}
+
+bool OpenTags::has_heading() const
+{
+	return has(TAG_H1) || has(TAG_H2) || has(TAG_H3) ||
+		has(TAG_H4) || has(TAG_H5) || has(TAG_H6);
+}
+
+bool OpenTags::has_hidden() const
+{
+	return has(TAG_HEAD) || has(TAG_SCRIPT) || has(TAG_STYLE);
+}
+
+bool OpenTags::may_have_unknown(const StringView & name) const
+{
+	return unknown_counts[bucket(name)] > 0;
+}
+
+// Converted part of a document that starts where all elements are closed.
+struct Piece {
+	std::string text; // Not colored or wrapped yet.
+	// Targets of links that make references and their numbers,
+	// or 0 for links that were written inline as there was no room for them.
+	std::string reference_targets;
+	std::vector<size_t> reference_ends;
+	std::vector<size_t> reference_numbers;
+	size_t end; // Offset in the document.
+	bool complete; // Whether all elements are closed at the end.
+	Piece() : end(0), complete(false) {}
+};
+
+// Converter of documents with options that were set when it was made.
+struct Processor {
+	virtual ~Processor() {}
+	virtual Status process(const StringView & html, const Sink & output_sink, Stats * html_stats = nullptr) = 0;
+	// Starts a document that is given in chunks.
+	virtual void start_push(const Sink & output_sink, Stats * html_stats = nullptr) = 0;
+	// Converts tokens of the chunk that are complete (all of them if it is the last one)
+	// and returns the size of the converted part. The rest has to be given again
+	// at the start of the next chunk. The output is finished by finish_push().
+	virtual size_t push(const StringView & chunk, bool last) = 0;
+	virtual Status finish_push() = 0;
+
+	// Collects targets of references made by tags from begin up to the first tag
+	// that starts at or after limit, and returns the offset of that tag.
+	virtual size_t collect_references(const StringView & html, size_t begin, size_t limit,
+			std::string & targets, std::vector<size_t> & ends) = 0;
+	// Converts tags from begin, where all elements have to be closed,
+	// up to the first tag that starts at or after limit
+	// (and, if to_top_level is set, where all elements are closed again).
+	// References are numbered by the index. Targets that are not there yet
+	// are added to it if adding_references is set; otherwise the piece
+	// keeps the numbers it used, to be checked by take_references().
+	virtual void process_piece(const StringView & html, size_t begin, size_t limit,
+			bool to_top_level, ReferenceIndex & index, bool adding_references, Piece & piece) = 0;
+	// Joins pieces converted in document order into the complete output.
+	virtual void start_output(const Sink & output_sink) = 0;
+	virtual ReferenceIndex & reference_index() = 0;
+	// Adds references of the piece to the index, unless the piece
+	// used numbers that do not follow the ones already there.
+	virtual bool take_references(const Piece & piece) = 0;
+	// Returns false when the output limit is hit.
+	virtual bool write_piece(const Piece & piece) = 0;
+	virtual Status finish_output() = 0;
+};
+
+// Options known at compile time: checks of them are constant,
+// so a processor made for them carries no code for other options.
+template<int fixed_options>
+struct FixedOptions {
+	explicit FixedOptions(int) {}
+	bool has(int option) const { return (fixed_options & option) != 0; }
+};
+
+// Options checked at run time, for combinations that are not instantiated.
+struct RuntimeOptions {
+	explicit RuntimeOptions(int runtime_options) : value(runtime_options) {}
+	bool has(int option) const { return (value & option) != 0; }
+	const int value;
+};
+
+// All output goes to one buffer. Open elements are nested tails of it,
+// so the text is written once where it belongs: a prefix is written
+// when an element is opened and its renderer appends a suffix
+// or trims the content in place when the element is closed.
+// Only renderers that reformat lines (lists, pre, blockquote) rewrite the content.
+template<class Options>
+struct Html2MarkProcessor : Processor {
+	Html2MarkProcessor(int html_options, size_t html_min_reference_links_length,
+			size_t html_wrap_width, const Limits & html_limits);
+	Status process(const StringView & html, const Sink & output_sink, Stats * html_stats = nullptr);
+	void start_push(const Sink & output_sink, Stats * html_stats = nullptr);
+	size_t push(const StringView & chunk, bool last);
+	Status finish_push();
+	size_t collect_references(const StringView & html, size_t begin, size_t limit,
+			std::string & targets, std::vector<size_t> & ends);
+	void process_piece(const StringView & html, size_t begin, size_t limit,
+			bool to_top_level, ReferenceIndex & index, bool adding_references, Piece & piece);
+	void start_output(const Sink & output_sink);
+	ReferenceIndex & reference_index() { return own_references; }
+	bool take_references(const Piece & piece);
+	bool write_piece(const Piece & piece);
+	Status finish_output();
+private:
+	typedef void (Html2MarkProcessor::*OpenHandler)();
+	typedef void (Html2MarkProcessor::*PrefixHandler)(const TaggedContent & value);
+	typedef void (Html2MarkProcessor::*RenderHandler)(const TaggedContent & value);
+	struct Handlers;
+	static const Handlers handlers;
+
+	StringView input;
+	const Sink * sink;
+	Stats * stats;
+	const Options options;
+	const size_t min_reference_links_length;
+	const Limits limits;
+	std::string result;
+	std::string scratch;
+	SlotStack<TaggedContent> parts;
+	Tokenizer tokenizer;
+	Arena arena;
+	OpenTags open_tags;
+	ReferenceIndex own_references;
+	ReferenceIndex * references; // Index that links are numbered by.
+	bool adds_references;
+	Piece * numbered_piece; // Piece that keeps numbers of its references, if any.
+	std::string link_target;
+	std::vector<std::string> open_links; // Targets of links open while collecting references.
+	SlotStack<List> lists;
+	size_t list_items_size;
+	// Output and list items before the outermost hidden element, if one is open.
+	size_t hidden_start;
+	size_t hidden_items_size;
+	size_t output_size;
+	bool output_too_large;
+	bool waits_for_first_tag; // Whether text before the first tag has not come in full yet.
+	Clock::time_point push_start_time;
+	ColorNormalizer color_normalizer;
+	std::string colored;
+	LineWrapper line_wrapper;
+	std::string wrapped;
+
+	Tag tag;
+	StringView tag_name;
+	bool closing;
+	std::string tag_content;
+	Attributes tag_attrs;
+
+	bool colors() const;
+	bool has_tag(Tag tag_id, const StringView & name = StringView()) const;
+	bool is_in_tag(Tag tag_id) const;
+
+	void open_element();
+	void open_unknown();
+	void open_code();
+	void open_list();
+	void open_list_item();
+	void open_paragraph();
+	void open_ruler();
+	void open_line_break();
+	void open_image();
+	void close_element();
+
+	void prefix_none(const TaggedContent & value);
+	void prefix_unknown(const TaggedContent & value);
+	void prefix_line(const TaggedContent & value);
+	void prefix_emphasis(const TaggedContent & value);
+	void prefix_strong(const TaggedContent & value);
+	void prefix_code(const TaggedContent & value);
+	void prefix_list_item(const TaggedContent & value);
+	void prefix_heading(const TaggedContent & value);
+	void prefix_link(const TaggedContent & value);
+
+	void render_unknown(const TaggedContent & value);
+	void render_pass(const TaggedContent & value);
+	void render_div(const TaggedContent & value);
+	void render_head(const TaggedContent & value);
+	void render_paragraph(const TaggedContent & value);
+	void render_emphasis(const TaggedContent & value);
+	void render_strong(const TaggedContent & value);
+	void render_code(const TaggedContent & value);
+	void render_list(const TaggedContent & value);
+	void render_list_item(const TaggedContent & value);
+	void render_heading(const TaggedContent & value);
+	void render_link(const TaggedContent & value);
+	bool makes_reference(const StringView & url) const;
+	bool has_room_for_reference(const ReferenceIndex & index) const;
+	size_t reference_number(const StringView & target);
+	bool accepts_attribute(const Attribute & attr) const;
+	bool exceeds_output_limit(size_t pending_size) const;
+	size_t pending_output_size() const;
+	void finish_link(const StringView & url, const Attributes & attrs);
+	void render_pre(const TaggedContent & value);
+	void render_blockquote(const TaggedContent & value);
+
+	bool is_empty(const TaggedContent & value) const;
+	void discard(const TaggedContent & value);
+	void trim_left(const TaggedContent & value);
+	void trim_right(const TaggedContent & value);
+	void replace_with_scratch(const TaggedContent & value);
+	void process_tag(const TaggedContent & value);
+	StringView keep(const StringView & text);
+	void push_element();
+	TaggedContent & pop_element();
+	void collapse_tag(Tag tag_id, const StringView & name = StringView());
+	void collapse_all();
+	void add_content(const std::string & content);
+	void start(const StringView & html, ReferenceIndex & index, bool adding_references);
+	void process_token();
+	void clear_elements();
+	void clear_output();
+	void stop_output();
+	template<bool with_stats>
+	void process_tokens(bool last);
+	void append_references();
+	void write_result(bool finishing = false);
+	void write_output(const char * data, size_t size, bool finishing = false);
+};
+
+// Jump tables indexed by tag: what to do when the tag is met,
+// what to write before the element content and how to finish
+// the element when it is closed.
+template<class Options>
+struct Html2MarkProcessor<Options>::Handlers {
+	OpenHandler open[TAG_COUNT];
+	PrefixHandler prefix[TAG_COUNT];
+	RenderHandler render[TAG_COUNT];
+	Handlers();
+};
+
+template<class Options>
+Html2MarkProcessor<Options>::Handlers::Handlers()
+{
+	for(int i = 0; i < TAG_COUNT; ++i) {
+		open[i] = &Html2MarkProcessor::open_element;
+		prefix[i] = &Html2MarkProcessor::prefix_none;
+		render[i] = &Html2MarkProcessor::render_unknown;
+	}
+	open[UNKNOWN_TAG] = &Html2MarkProcessor::open_unknown;
+	open[TAG_CODE] = &Html2MarkProcessor::open_code;
+	open[TAG_OL] = &Html2MarkProcessor::open_list;
+	open[TAG_UL] = &Html2MarkProcessor::open_list;
+	open[TAG_LI] = &Html2MarkProcessor::open_list_item;
+	open[TAG_P] = &Html2MarkProcessor::open_paragraph;
+	open[TAG_HR] = &Html2MarkProcessor::open_ruler;
+	open[TAG_BR] = &Html2MarkProcessor::open_line_break;
+	open[TAG_IMG] = &Html2MarkProcessor::open_image;
+
+	prefix[UNKNOWN_TAG] = &Html2MarkProcessor::prefix_unknown;
+	prefix[TAG_DIV] = &Html2MarkProcessor::prefix_line;
+	prefix[TAG_P] = &Html2MarkProcessor::prefix_line;
+	prefix[TAG_EM] = &Html2MarkProcessor::prefix_emphasis;
+	prefix[TAG_I] = &Html2MarkProcessor::prefix_emphasis;
+	prefix[TAG_B] = &Html2MarkProcessor::prefix_strong;
+	prefix[TAG_STRONG] = &Html2MarkProcessor::prefix_strong;
+	prefix[TAG_CITE] = &Html2MarkProcessor::prefix_code;
+	prefix[TAG_CODE] = &Html2MarkProcessor::prefix_code;
+	prefix[TAG_LI] = &Html2MarkProcessor::prefix_list_item;
+	for(int level = TAG_H1; level <= TAG_H6; ++level) {
+		prefix[level] = &Html2MarkProcessor::prefix_heading;
+	}
+	prefix[TAG_A] = &Html2MarkProcessor::prefix_link;
+
+	render[TAG_HTML] = &Html2MarkProcessor::render_pass;
+	render[TAG_BODY] = &Html2MarkProcessor::render_pass;
+	render[TAG_SPAN] = &Html2MarkProcessor::render_pass;
+	render[TAG_DIV] = &Html2MarkProcessor::render_div;
+	// Content that is not shown is dropped.
+	render[TAG_HEAD] = &Html2MarkProcessor::render_head;
+	render[TAG_SCRIPT] = &Html2MarkProcessor::render_head;
+	render[TAG_STYLE] = &Html2MarkProcessor::render_head;
+	render[TAG_P] = &Html2MarkProcessor::render_paragraph;
+	render[TAG_EM] = &Html2MarkProcessor::render_emphasis;
+	render[TAG_I] = &Html2MarkProcessor::render_emphasis;
+	render[TAG_B] = &Html2MarkProcessor::render_strong;
+	render[TAG_STRONG] = &Html2MarkProcessor::render_strong;
+	render[TAG_CITE] = &Html2MarkProcessor::render_code;
+	render[TAG_CODE] = &Html2MarkProcessor::render_code;
+	render[TAG_OL] = &Html2MarkProcessor::render_list;
+	render[TAG_UL] = &Html2MarkProcessor::render_list;
+	render[TAG_LI] = &Html2MarkProcessor::render_list_item;
+	for(int level = TAG_H1; level <= TAG_H6; ++level) {
+		render[level] = &Html2MarkProcessor::render_heading;
+	}
+	render[TAG_A] = &Html2MarkProcessor::render_link;
+	render[TAG_PRE] = &Html2MarkProcessor::render_pre;
+	render[TAG_BLOCKQUOTE] = &Html2MarkProcessor::render_blockquote;
+	// Void elements are written when met and never opened,
+	// so they are closed as plain ones if they ever are.
+	render[TAG_BR] = &Html2MarkProcessor::render_pass;
+	render[TAG_HR] = &Html2MarkProcessor::render_pass;
+	render[TAG_IMG] = &Html2MarkProcessor::render_pass;
+}
+
+template<class Options>
+const typename Html2MarkProcessor<Options>::Handlers Html2MarkProcessor<Options>::handlers;
+
+template<class Options>
+Html2MarkProcessor<Options>::Html2MarkProcessor(int html_options,
+		size_t html_min_reference_links_length, size_t html_wrap_width,
+		const Limits & html_limits)
+	: sink(nullptr), stats(nullptr), options(html_options),
+	min_reference_links_length(html_min_reference_links_length),
+	limits(html_limits),
+	references(&own_references), adds_references(true), numbered_piece(nullptr),
+	list_items_size(0), hidden_start(0), hidden_items_size(0), output_size(0), output_too_large(false), waits_for_first_tag(false),
+	line_wrapper(html_wrap_width),
+	tag(UNKNOWN_TAG), closing(false)
+{}
+
+template<class Options>
+bool Html2MarkProcessor<Options>::colors() const
+{
+	return options.has(COLORS);
+}
+
+template<class Options>
+bool Html2MarkProcessor<Options>::has_tag(Tag tag_id, const StringView & name) const
+{
+	if(tag_id != UNKNOWN_TAG) {
+		return open_tags.has(tag_id);
+	}
+	if(!open_tags.may_have_unknown(name)) {
+		return false;
+	}
+	for(size_t i = parts.size(); i > 0; --i) {
+		if(is_same_tag(parts[i - 1], tag_id, name)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+template<class Options>
+bool Html2MarkProcessor<Options>::is_in_tag(Tag tag_id) const
+{
+	return (!closing && tag == tag_id) || open_tags.has(tag_id);
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::prefix_none(const TaggedContent &)
+{
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::prefix_unknown(const TaggedContent & value)
+{
+	result += '<';
+	result.append(value.name.data(), value.name.size());
+	result += '>';
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::prefix_line(const TaggedContent &)
+{
+	result += '\n';
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::prefix_emphasis(const TaggedContent &)
+{
+	if(colors()) {
+		bool strong_em = open_tags.has(TAG_B) || open_tags.has(TAG_STRONG);
+		result += strong_em ? BOLD_CYAN : CYAN;
+	} else {
+		result += '_';
+	}
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::prefix_strong(const TaggedContent &)
+{
+	if(colors()) {
+		if(open_tags.has_heading()) {
+			result += BOLD_PURPLE;
+		} else if(open_tags.has(TAG_I) || open_tags.has(TAG_EM)) {
+			result += BOLD_CYAN;
+		} else {
+			result += WHITE;
+		}
+	} else {
+		result += "**";
+	}
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::prefix_code(const TaggedContent &)
+{
+	result += '`';
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::prefix_list_item(const TaggedContent &)
+{
+	if(lists.empty()) {
+		result += '\n';
+	}
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::prefix_heading(const TaggedContent & value)
+{
+	size_t level = size_t(value.tag - TAG_H1) + 1;
+	result += '\n';
+	if(colors()) {
+		result += PURPLE;
+	}
+	if(level > 2 || !options.has(UNDERSCORED_HEADINGS)) {
+		result.append(level, '#');
+		result += ' ';
+	}
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::prefix_link(const TaggedContent & value)
+{
+	if(value.attrs.has(ATTR_HREF)) {
+		result += colors() ? BLUE : "[";
+	}
+}
+
+template<class Options>
+bool Html2MarkProcessor<Options>::is_empty(const TaggedContent & value) const
+{
+	return result.size() == value.start;
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::discard(const TaggedContent & value)
+{
+	result.resize(value.prefix_start);
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::trim_left(const TaggedContent & value)
+{
+	size_t pos = value.start;
+	while(pos < result.size() && is_space(result[pos])) {
+		++pos;
+	}
+	result.erase(value.start, pos - value.start);
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::trim_right(const TaggedContent & value)
+{
+	size_t end = result.size();
+	while(end > value.start && is_space(result[end - 1])) {
+		--end;
+	}
+	result.resize(end);
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::replace_with_scratch(const TaggedContent & value)
+{
+	result.resize(value.prefix_start);
+	result += scratch;
+	scratch.clear();
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::render_unknown(const TaggedContent & value)
+{
+	if(starts_with_h(value.name) && is_empty(value)) {
+		discard(value);
+		return;
+	}
+	result += "</";
+	result.append(value.name.data(), value.name.size());
+	result += '>';
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::render_pass(const TaggedContent & value)
+{
+	trim_right(value);
+	trim_left(value);
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::render_div(const TaggedContent & value)
+{
+	trim_right(value);
+	trim_left(value);
+	result += '\n';
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::render_head(const TaggedContent & value)
+{
+	discard(value);
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::render_paragraph(const TaggedContent & value)
+{
+	trim_right(value);
+	result += '\n';
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::render_emphasis(const TaggedContent & value)
+{
+	if(is_empty(value)) {
+		discard(value);
+	} else if(colors()) {
+		result += RESET;
+	} else {
+		result += '_';
+	}
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::render_strong(const TaggedContent & value)
+{
+	if(is_empty(value)) {
+		discard(value);
+	} else if(colors()) {
+		result += RESET;
+	} else {
+		result += "**";
+	}
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::render_code(const TaggedContent & value)
+{
+	if(is_empty(value)) {
+		discard(value);
+	} else {
+		result += '`';
+	}
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::render_list(const TaggedContent & value)
+{
+	if(lists.empty()) {
+		result.insert(value.start, 1, '\n');
+		result += '\n';
+		return;
+	}
+	if(!is_empty(value)) {
+		scratch += '\n';
+		scratch.append(result, value.start, std::string::npos);
+		scratch += '\n';
+	}
+	scratch += '\n';
+	const List & list = lists.back();
+	size_t item_start = 0;
+	for(size_t index = 0; index < list.item_ends.size(); ++index) {
+		const char * item = list.items.data() + item_start;
+		const char * item_end = list.items.data() + list.item_ends[index];
+		bool is_first_line = true;
+		for_each_line(item, item_end, [&](const char * line, const char * line_end) {
+				if(!is_first_line) {
+					scratch += "  ";
+				} else if(list.numbered) {
+					if(colors()) {
+						scratch += YELLOW + std::to_string(index + 1) + "." + RESET + " ";
+					} else {
+						scratch += std::to_string(index + 1) + ". ";
+					}
+				} else {
+					if(colors()) {
+						scratch += YELLOW + "*" + RESET + " ";
+					} else {
+						scratch += "* ";
+					}
+				}
+				is_first_line = false;
+				scratch.append(line, line_end);
+				scratch += '\n';
+				});
+		item_start = list.item_ends[index];
+	}
+	list_items_size -= list.items.size();
+	lists.pop();
+	replace_with_scratch(value);
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::render_list_item(const TaggedContent & value)
+{
+	trim_right(value);
+	if(lists.empty()) {
+		result += '\n';
+		return;
+	}
+	trim_left(value);
+	List & list = lists.back();
+	list.items.append(result, value.start, std::string::npos);
+	list.item_ends.push_back(list.items.size());
+	list_items_size += result.size() - value.start;
+	discard(value);
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::render_heading(const TaggedContent & value)
+{
+	if(is_empty(value)) {
+		discard(value);
+		return;
+	}
+	size_t level = size_t(value.tag - TAG_H1) + 1;
+	trim_right(value);
+	if(level <= 2 && options.has(UNDERSCORED_HEADINGS)) {
+		char underscore = level == 1 ? '=' : '-';
+		size_t width = display_width(result.data() + value.start, result.size() - value.start);
+		result += '\n';
+		result.append(width, underscore);
+	}
+	if(colors()) {
+		result += RESET;
+	}
+	result += '\n';
+}
+
+static void append_link_target(std::string & out, const StringView & url, const Attributes & attrs)
+{
+	out.append(url.data(), url.size());
+	if(attrs.has(ATTR_TITLE)) {
+		out += " \"";
+		out.append(attrs.get(ATTR_TITLE).data(), attrs.get(ATTR_TITLE).size());
+		out += '"';
+	}
+}
+
+template<class Options>
+bool Html2MarkProcessor<Options>::makes_reference(const StringView & url) const
+{
+	return options.has(MAKE_REFERENCE_LINKS) && url.size() > min_reference_links_length;
+}
+
+template<class Options>
+bool Html2MarkProcessor<Options>::accepts_attribute(const Attribute & attr) const
+{
+	return attr.id != ATTR_COUNT
+		&& (limits.max_attribute_size == 0 || attr.value.size() <= limits.max_attribute_size);
+}
+
+template<class Options>
+bool Html2MarkProcessor<Options>::exceeds_output_limit(size_t pending_size) const
+{
+	return limits.max_output_size > 0 && output_size + pending_size > limits.max_output_size;
+}
+
+// Size of the output that is kept until its top-level block is closed.
+// Content of hidden elements is going to be dropped, so it is not counted.
+template<class Options>
+size_t Html2MarkProcessor<Options>::pending_output_size() const
+{
+	if(open_tags.has_hidden()) {
+		return hidden_start + hidden_items_size;
+	}
+	return result.size() + list_items_size;
+}
+
+template<class Options>
+bool Html2MarkProcessor<Options>::has_room_for_reference(const ReferenceIndex & index) const
+{
+	return limits.max_references == 0 || index.size() < limits.max_references;
+}
+
+// Number of the reference to the target, or 0 if the link is written inline.
+template<class Options>
+size_t Html2MarkProcessor<Options>::reference_number(const StringView & target)
+{
+	size_t number = references->find(target);
+	if(number == 0 && adds_references && has_room_for_reference(*references)) {
+		number = references->add(target);
+	}
+	if(numbered_piece) {
+		numbered_piece->reference_targets.append(target.data(), target.size());
+		numbered_piece->reference_ends.push_back(numbered_piece->reference_targets.size());
+		numbered_piece->reference_numbers.push_back(number);
+	}
+	return number;
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::finish_link(const StringView & url, const Attributes & attrs)
+{
+	link_target.clear();
+	append_link_target(link_target, url, attrs);
+	size_t number = makes_reference(url) ? reference_number(link_target) : 0;
+	if(number > 0) {
+		if(colors()) {
+			result += RESET;
+			result += GREEN;
+			result += '[';
+		} else {
+			result += "][";
+		}
+		result += std::to_string(number);
+		result += ']';
+	} else {
+		if(colors()) {
+			result += RESET;
+			result += GREEN;
+			result += '(';
+		} else {
+			result += "](";
+		}
+		result += link_target;
+		result += ')';
+	}
+	if(colors()) {
+		result += RESET;
+	}
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::render_link(const TaggedContent & value)
+{
+	if(value.attrs.has(ATTR_HREF)) {
+		finish_link(value.attrs.get(ATTR_HREF), value.attrs);
+	}
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::render_pre(const TaggedContent & value)
+{
+	for_each_line(result.data() + value.start, result.data() + result.size(),
+			[this](const char * line, const char * line_end) {
+			scratch += "\n\t";
+			scratch.append(line, line_end);
+			});
+	scratch += '\n';
+	replace_with_scratch(value);
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::render_blockquote(const TaggedContent & value)
+{
+	for_each_line(result.data() + value.start, result.data() + result.size(),
+			[this](const char * line, const char * line_end) {
+			if(colors()) {
+				scratch += '\n';
+				scratch += YELLOW;
+				scratch += '>';
+				scratch += RESET;
+				scratch += ' ';
+			} else {
+				scratch += "\n> ";
+			}
+			scratch.append(line, line_end);
+			});
+	scratch += '\n';
+	replace_with_scratch(value);
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::process_tag(const TaggedContent & value)
+{
+	(this->*handlers.render[value.tag])(value);
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::add_content(const std::string & content)
+{
+	result += content;
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::push_element()
+{
+	if(tag == TAG_LI && !lists.empty()) {
+		++lists.back().open_items;
+	}
+	if(is_hidden(tag) && !open_tags.has_hidden()) {
+		hidden_start = result.size();
+		hidden_items_size = list_items_size;
+	}
+	TaggedContent & value = parts.push();
+	value.tag = tag;
+	value.name = tag == UNKNOWN_TAG ? keep(tag_name) : StringView();
+	value.attrs.clear();
+	for(int i = 0; i < ATTR_COUNT; ++i) {
+		AttributeName name = AttributeName(i);
+		if(tag_attrs.has(name)) {
+			value.attrs.set(name, keep(tag_attrs.get(name)));
+		}
+	}
+	value.prefix_start = result.size();
+	(this->*handlers.prefix[tag])(value);
+	value.start = result.size();
+	result += tag_content;
+	open_tags.add(value, 1);
+}
+
+// Decoded attribute values live in the tokenizer only until the next tag,
+// and pushed chunks only until the next one.
+template<class Options>
+StringView Html2MarkProcessor<Options>::keep(const StringView & text)
+{
+	bool in_input = text.data() >= input.data() && text.data() < input.data() + input.size();
+	return in_input ? text : arena.copy(text);
+}
+
+template<class Options>
+TaggedContent & Html2MarkProcessor<Options>::pop_element()
+{
+	TaggedContent & value = parts.pop();
+	open_tags.add(value, -1);
+	if(value.tag == TAG_LI && !lists.empty()) {
+		--lists.back().open_items;
+	}
+	return value;
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::collapse_tag(Tag tag_id, const StringView & name)
+{
+	while(!parts.empty()) {
+		TaggedContent & value = pop_element();
+		process_tag(value);
+		if(is_same_tag(value, tag_id, name)) {
+			break;
+		}
+	}
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::collapse_all()
+{
+	while(!parts.empty()) {
+		process_tag(pop_element());
+	}
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::open_element()
+{
+	push_element();
+}
+
+// Unknown elements may be closed by their opening tag, like SVG shapes.
+// Text after the tag is not their content.
+template<class Options>
+void Html2MarkProcessor<Options>::open_unknown()
+{
+	if(!tokenizer.is_self_closing()) {
+		open_element();
+		return;
+	}
+	std::string content;
+	content.swap(tag_content);
+	open_element();
+	process_tag(pop_element());
+	content.swap(tag_content);
+	add_content(tag_content);
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::open_code()
+{
+	if(!parts.empty() && parts.back().tag == TAG_PRE && is_empty(parts.back())) {
+		add_content(tag_content);
+	} else {
+		open_element();
+	}
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::open_list()
+{
+	lists.push().start(tag == TAG_OL);
+	open_element();
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::open_list_item()
+{
+	if(!lists.empty() && lists.back().open_items > 0) {
+		collapse_tag(TAG_LI);
+	}
+	open_element();
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::open_paragraph()
+{
+	if(open_tags.has(TAG_P)) {
+		collapse_tag(TAG_P);
+	}
+	open_element();
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::open_ruler()
+{
+	if(colors()) {
+		add_content("\n" + PURPLE + "* * *" + RESET + "\n");
+	} else {
+		add_content("\n* * *\n");
+	}
+	add_content(tag_content);
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::open_line_break()
+{
+	add_content("\n");
+	add_content(tag_content);
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::open_image()
+{
+	if(colors()) {
+		result += BLUE;
+	}
+	result += "![";
+	result.append(tag_attrs.get(ATTR_ALT).data(), tag_attrs.get(ATTR_ALT).size());
+	if(colors()) {
+		result += ']';
+	}
+	finish_link(tag_attrs.get(ATTR_SRC), tag_attrs);
+	add_content(tag_content);
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::close_element()
+{
+	if(has_tag(tag, tag_name)) {
+		collapse_tag(tag, tag_name);
+	}
+	bool is_paragraph = tag == TAG_P || (tag >= TAG_H1 && tag <= TAG_H6)
+		|| tag == TAG_HEAD || tag == TAG_HR || tag == TAG_HTML
+		|| (tag == UNKNOWN_TAG && starts_with_h(tag_name));
+	if(is_paragraph) {
+		const char * begin = tag_content.data();
+		const char * end = begin + tag_content.size();
+		while(begin < end && is_space(*begin)) {
+			++begin;
+		}
+		while(end > begin && is_space(end[-1])) {
+			--end;
+		}
+		result.append(begin, end);
+	} else {
+		add_content(tag_content);
+	}
+}
+
+// Conversion that was stopped by an exception may have left anything,
+// so elements and output are dropped at the start of the next one.
+template<class Options>
+void Html2MarkProcessor<Options>::start(const StringView & html, ReferenceIndex & index, bool adding_references)
+{
+	input = html;
+	tokenizer.reset(input);
+	arena.reset();
+	references = &index;
+	adds_references = adding_references;
+	numbered_piece = nullptr;
+	clear_elements();
+}
+
+// Whether the opening tag makes an element.
+static bool makes_element(Tag tag)
+{
+	return tag != TAG_HR && tag != TAG_BR && tag != TAG_IMG;
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::process_token()
+{
+	tag = tokenizer.tag();
+	tag_name = tokenizer.tag_name();
+	closing = tokenizer.is_closing();
+	tag_attrs.clear();
+	for(const Attribute & attr : tokenizer.attributes()) {
+		if(accepts_attribute(attr) && !tag_attrs.has(attr.id)) {
+			tag_attrs.set(attr.id, attr.value);
+		}
+	}
+
+	tag_content.clear();
+	bool keep_whitespaces = is_in_tag(TAG_PRE) || is_in_tag(TAG_CODE);
+	bool keep_border_spaces = is_in_tag(TAG_I) || is_in_tag(TAG_EM)
+		|| is_in_tag(TAG_B) || is_in_tag(TAG_STRONG);
+	append_text(tag_content, tokenizer.text(), !keep_whitespaces,
+			!keep_border_spaces, tokenizer.text_has_references());
+
+	if(tag_name.empty()) {
+		add_content(tag_content);
+	} else if(closing) {
+		close_element();
+	} else if(limits.max_depth > 0 && parts.size() >= limits.max_depth && makes_element(tag)) {
+		add_content(tag_content);
+	} else {
+		(this->*handlers.open[tag])();
+	}
+}
+
+// Stats are collected by a separate instance of the loop,
+// so that conversion without them does not spend anything on it.
+template<class Options>
+template<bool with_stats>
+void Html2MarkProcessor<Options>::process_tokens(bool last)
+{
+	Clock::time_point time;
+	if(with_stats) {
+		time = Clock::now();
+	}
+	while(!output_too_large && tokenizer.next()) {
+		if(with_stats) {
+			lap(time, stats->tokenize_time);
+			++stats->tokens;
+		}
+		process_token();
+		if(with_stats) {
+			lap(time, stats->render_time);
+			// Opening tag that makes an element leaves it on the top.
+			if(!closing && !tag_name.empty() && !parts.empty() && parts.back().tag == tag) {
+				++stats->elements;
+			}
+			stats->max_depth = std::max(stats->max_depth, parts.size());
+			stats->peak_buffer_size = std::max(stats->peak_buffer_size, result.size());
+		}
+		if(exceeds_output_limit(pending_output_size())) {
+			output_too_large = true;
+		} else if(parts.empty()) {
+			write_result();
+			// Nothing is open any more, so names and attributes
+			// kept for open elements are not needed.
+			arena.reset();
+			if(with_stats) {
+				time = Clock::now();
+			}
+		}
+	}
+	if(last && !output_too_large) {
+		collapse_all();
+	}
+	if(with_stats) {
+		lap(time, stats->render_time);
+		stats->peak_buffer_size = std::max(stats->peak_buffer_size, result.size());
+	}
+}
+
+template<class Options>
+Status Html2MarkProcessor<Options>::process(const StringView & html, const Sink & output_sink, Stats * html_stats)
+{
+	Clock::time_point start_time;
+	stats = html_stats;
+	if(stats) {
+		start_time = Clock::now();
+		*stats = Stats();
+		stats->input_size = html.size();
+	}
+	start(html, own_references, true);
+	start_output(output_sink);
+	append_text(result, tokenizer.text(), true, false, tokenizer.text_has_references());
+	if(stats) {
+		process_tokens<true>(true);
+	} else {
+		process_tokens<false>(true);
+	}
+	if(stats) {
+		stats->references = own_references.size();
+	}
+	Status status = finish_output();
+	if(stats) {
+		lap(start_time, stats->total_time);
+		stats = nullptr;
+	}
+	return status;
+}
+
+// Elements of a pushed document outlive the chunks they came in,
+// so their names and attributes are kept in the arena.
+template<class Options>
+void Html2MarkProcessor<Options>::start_push(const Sink & output_sink, Stats * html_stats)
+{
+	stats = html_stats;
+	if(stats) {
+		push_start_time = Clock::now();
+		*stats = Stats();
+	}
+	start(StringView(), own_references, true);
+	start_output(output_sink);
+	waits_for_first_tag = true;
+}
+
+template<class Options>
+size_t Html2MarkProcessor<Options>::push(const StringView & chunk, bool last)
+{
+	if(output_too_large) {
+		return chunk.size();
+	}
+	tokenizer.reset(chunk, last);
+	if(waits_for_first_tag) {
+		if(tokenizer.needs_input()) {
+			return 0;
+		}
+		append_text(result, tokenizer.text(), true, false, tokenizer.text_has_references());
+		waits_for_first_tag = false;
+	}
+	if(stats) {
+		process_tokens<true>(last);
+	} else {
+		process_tokens<false>(last);
+	}
+	size_t converted = output_too_large ? chunk.size() : size_t(tokenizer.position() - chunk.data());
+	if(stats) {
+		stats->input_size += converted;
+	}
+	return converted;
+}
+
+template<class Options>
+Status Html2MarkProcessor<Options>::finish_push()
+{
+	if(stats) {
+		stats->references = own_references.size();
+	}
+	Status status = finish_output();
+	if(stats) {
+		lap(push_start_time, stats->total_time);
+		stats = nullptr;
+	}
+	return status;
+}
+
+// Links are numbered when they are finished: images at once,
+// links on their closing tags, so targets of open links wait on a stack.
+template<class Options>
+size_t Html2MarkProcessor<Options>::collect_references(const StringView & html, size_t begin, size_t limit,
+		std::string & targets, std::vector<size_t> & ends)
 {
-	size_t result = 0;
-	for(char c : s) {
-		result += (c & 0xc0) != 0x80;
+	tokenizer.reset(StringView(html.data() + begin, html.size() - begin));
+	const char * stop = html.data() + limit;
+	targets.clear();
+	ends.clear();
+	size_t open_count = 0;
+	while(tokenizer.position() < stop && tokenizer.next()) {
+		Tag link_tag = tokenizer.tag();
+		if(link_tag != TAG_A && link_tag != TAG_IMG) {
+			continue;
+		}
+		if(tokenizer.is_closing()) {
+			if(link_tag == TAG_A && open_count > 0) {
+				const std::string & target = open_links[--open_count];
+				if(!target.empty()) {
+					targets += target;
+					ends.push_back(targets.size());
+				}
+			}
+			continue;
+		}
+		tag_attrs.clear();
+		for(const Attribute & attr : tokenizer.attributes()) {
+			if(accepts_attribute(attr) && !tag_attrs.has(attr.id)) {
+				tag_attrs.set(attr.id, attr.value);
+			}
+		}
+		const StringView & url = tag_attrs.get(link_tag == TAG_A ? ATTR_HREF : ATTR_SRC);
+		link_target.clear();
+		if(makes_reference(url)) {
+			append_link_target(link_target, url, tag_attrs);
+		}
+		if(link_tag == TAG_IMG) {
+			if(!link_target.empty()) {
+				targets += link_target;
+				ends.push_back(targets.size());
+			}
+		} else {
+			if(open_count == open_links.size()) {
+				open_links.emplace_back();
+			}
+			open_links[open_count++] = link_target;
+		}
 	}
-	return result;
+	while(open_count > 0) {
+		const std::string & target = open_links[--open_count];
+		if(!target.empty()) {
+			targets += target;
+			ends.push_back(targets.size());
+		}
+	}
+	return size_t(tokenizer.position() - html.data());
 }
 
-struct TaggedContent {
-	std::string tag, content;
-	typedef std::map<std::string, std::string> Attrs;
-	Attrs attrs;
-
-	TaggedContent(const std::string & given_tag = std::string(),
-			const std::string & given_content = std::string(),
-			const Attrs & given_attrs = Attrs()
-			)
-		: tag(given_tag), content(given_content), attrs(given_attrs)
-	{}
-};
+template<class Options>
+void Html2MarkProcessor<Options>::process_piece(const StringView & html, size_t begin, size_t limit,
+		bool to_top_level, ReferenceIndex & index, bool adding_references, Piece & piece)
+{
+	start(StringView(html.data() + begin, html.size() - begin), index, adding_references);
+	piece.text.clear();
+	piece.reference_targets.clear();
+	piece.reference_ends.clear();
+	piece.reference_numbers.clear();
+	if(!adding_references) {
+		numbered_piece = &piece;
+	}
+	append_text(piece.text, tokenizer.text(), true, false, tokenizer.text_has_references());
+	const char * stop = html.data() + limit;
+	while((tokenizer.position() < stop || (to_top_level && !parts.empty())) && tokenizer.next()) {
+		process_token();
+		if(parts.empty()) {
+			piece.text += result;
+			result.clear();
+		}
+	}
+	if(tokenizer.position() == input.end()) {
+		collapse_all();
+		piece.text += result;
+		result.clear();
+	}
+	piece.end = size_t(tokenizer.position() - html.data());
+	piece.complete = parts.empty();
+	while(!parts.empty()) {
+		pop_element();
+	}
+	result.clear();
+	numbered_piece = nullptr;
+}
 
-static bool has_tag(const std::vector<TaggedContent> & parts, const std::string & tag)
+template<class Options>
+void Html2MarkProcessor<Options>::start_output(const Sink & output_sink)
 {
-	return parts.rend() != std::find_if(
-			parts.rbegin(), parts.rend(),
-			[&tag](const TaggedContent & value) {
-			return value.tag == tag;
-			}
-			);
+	clear_output();
+	sink = &output_sink;
+	output_size = 0;
+	output_too_large = false;
+	own_references.clear();
+	if(colors()) {
+		color_normalizer.start(colored);
+		write_result();
+	}
 }
 
-static bool has_header_tag(const std::vector<TaggedContent> & parts)
+template<class Options>
+bool Html2MarkProcessor<Options>::write_piece(const Piece & piece)
 {
-	return has_tag(parts, "h1") || has_tag(parts, "h2") || has_tag(parts, "h3") || 
-		has_tag(parts, "h4") || has_tag(parts, "h5") || has_tag(parts, "h4");
+	write_output(piece.text.data(), piece.text.size());
+	return !output_too_large;
 }
 
-struct List {
-	bool numbered;
-	std::vector<std::string> items;
-	List(bool numbered_list) : numbered(numbered_list) {}
-};
+template<class Options>
+bool Html2MarkProcessor<Options>::take_references(const Piece & piece)
+{
+	size_t count = own_references.size();
+	size_t start = 0;
+	for(size_t index = 0; index < piece.reference_numbers.size(); ++index) {
+		StringView target(piece.reference_targets.data() + start, piece.reference_ends[index] - start);
+		start = piece.reference_ends[index];
+		size_t number = own_references.find(target);
+		bool fits;
+		if(number > 0) {
+			fits = number == piece.reference_numbers[index];
+		} else if(piece.reference_numbers[index] == 0) {
+			fits = !has_room_for_reference(own_references);
+		} else {
+			fits = has_room_for_reference(own_references)
+				&& own_references.size() + 1 == piece.reference_numbers[index];
+			if(fits) {
+				own_references.add(target);
+			}
+		}
+		if(!fits) {
+			own_references.truncate(count);
+			return false;
+		}
+	}
+	return true;
+}
 
-struct Html2MarkProcessor {
-	Html2MarkProcessor(std::istream & input_stream, int html_options,
-			size_t html_min_reference_links_length, size_t html_wrap_width);
-	void process();
-	const std::string & get_result() const { return result; }
-private:
-	std::istream & stream;
-	const int options;
-	const size_t min_reference_links_length;
-	const size_t wrap_width;
-	std::string result;
-	std::vector<TaggedContent> parts;
-	std::vector<std::pair<unsigned, std::string>> references;
-	std::vector<List> lists;
+template<class Options>
+Status Html2MarkProcessor<Options>::finish_output()
+{
+	if(!output_too_large) {
+		append_references();
+		write_result(true);
+	}
+	if(!output_too_large) {
+		return CONVERTED;
+	}
+	stop_output();
+	return OUTPUT_TOO_LARGE;
+}
 
-	bool colors() const;
-	std::string process_tag(const TaggedContent & value);
-	void collapse_tag(const std::string & tag = std::string());
-	void add_content(const std::string & content);
-};
+// Drops what is left of conversion stopped on the output limit
+// at once instead of keeping it until the next conversion.
+template<class Options>
+void Html2MarkProcessor<Options>::stop_output()
+{
+	clear_elements();
+	clear_output();
+}
 
-Html2MarkProcessor::Html2MarkProcessor(std::istream & input_stream,
-		int html_options, size_t html_min_reference_links_length, size_t html_wrap_width)
-	: stream(input_stream), options(html_options),
-	min_reference_links_length(html_min_reference_links_length),
-	wrap_width(html_wrap_width)
-{}
+// Counters of open tags are not taken from the elements,
+// as they may be out of step with them after an exception.
+template<class Options>
+void Html2MarkProcessor<Options>::clear_elements()
+{
+	parts.clear();
+	open_tags = OpenTags();
+	result.clear();
+	scratch.clear();
+	lists.clear();
+	list_items_size = 0;
+}
 
-bool Html2MarkProcessor::colors() const
+template<class Options>
+void Html2MarkProcessor<Options>::clear_output()
 {
-	return options & COLORS;
+	color_normalizer.finish(colored);
+	line_wrapper.finish(wrapped);
+	colored.clear();
+	wrapped.clear();
 }
 
-std::string Html2MarkProcessor::process_tag(const TaggedContent & value)
+template<class Options>
+void Html2MarkProcessor<Options>::append_references()
 {
-	static std::vector<std::string> pass_tags = {"html", "body", "span", "div"};
-	if(value.tag.empty()) {
-		return value.content;
-	} else if(Chthon::contains(pass_tags, value.tag)) {
-		if(value.tag == "div") {
-			return "\n" + Chthon::trim(value.content) + "\n";
-		}
-		return Chthon::trim(value.content);
-	} else if(value.tag == "head") {
-		return "";
-	} else if(value.tag == "p") {
-		return "\n" + Chthon::trim_right(value.content) + "\n";
-	} else if(value.tag == "em" || value.tag == "i") {
+	if(own_references.size() == 0) {
+		return;
+	}
+	result += "\n\n";
+	for(size_t number = 1; number <= own_references.size(); ++number) {
 		if(colors()) {
-			bool strong_em = has_tag(parts, "b") || has_tag(parts, "strong");
-			std::string color = strong_em ? BOLD_CYAN : CYAN;
-			return value.content.empty() ? "" : color + value.content + RESET;
-		} else {
-			return value.content.empty() ? "" : "_" + value.content + "_";
+			result += GREEN;
 		}
-	} else if(value.tag == "b" || value.tag == "strong") {
+		result += '[';
+		result += std::to_string(number);
+		result += ']';
 		if(colors()) {
-			std::string color = WHITE;
-			if(has_header_tag(parts)) {
-				color = BOLD_PURPLE;
-			} else if(has_tag(parts, "i") || has_tag(parts, "em")) {
-				color = BOLD_CYAN;
-			}
-			return value.content.empty() ? "" : color + value.content + RESET;
-		} else {
-			return value.content.empty() ? "" : "**" + value.content + "**";
-		}
-	} else if(value.tag == "cite") {
-		return value.content.empty() ? "" : "`" + value.content + "`";
-	} else if(value.tag == "code") {
-		return value.content.empty() ? "" : "`" + value.content + "`";
-	} else if(value.tag == "ol" || value.tag == "ul") {
-		if(lists.empty()) {
-			return "\n" + value.content + "\n";
-		}
-		std::string content;
-		if(!value.content.empty()) {
-			content = "\n" + value.content + "\n";
-		}
-		content += '\n';
-		int index = 1;
-		for(const std::string & item : lists.back().items) {
-			std::vector<std::string> lines;
-			Chthon::split(item, lines);
-			bool is_first_line = true;
-			for(const std::string & line : lines) {
-				if(is_first_line) {
-					std::string number;
-					if(lists.back().numbered) {
-						if(colors()) {
-							number = YELLOW + std::to_string(index) + "." + RESET + " ";
-						} else {
-							number = std::to_string(index) + ". ";
-						}
-					} else {
-						if(colors()) {
-							number = YELLOW + "*" + RESET + " ";
-						} else {
-							number = "* ";
-						}
-					}
-					content += number + line + "\n";
-					is_first_line = false;
-				} else {
-					content += "  " + line + "\n";
-				}
-			}
-			++index;
+			result += RESET;
 		}
-		lists.pop_back();
-		return content;
-	} else if(value.tag == "li") {
-		if(lists.empty()) {
-			return "\n" + Chthon::trim_right(value.content) + "\n";
-		}
-		lists.back().items.push_back(Chthon::trim(value.content));
-		return "";
-	} else if(Chthon::starts_with(value.tag, "h")) {
-		if(value.content.empty()) {
-			return "";
-		}
-		size_t level = strtoul(value.tag.substr(1).c_str(), nullptr, 10);
-		if(level < 1 || 6 < level) {
-			return Chthon::format("<{0}>{1}</{0}>", value.tag, value.content);
-		}
-		std::string content = Chthon::trim_right(value.content);
-		if(level <= 2 && options & UNDERSCORED_HEADINGS) {
-			char underscore = level == 1 ? '=' : '-';
-			if(colors()) {
-				return "\n" + PURPLE + content + "\n" +
-					std::string(utf8_size(content), underscore) + RESET + "\n";
-			} else {
-				return "\n" + content + "\n" +
-					std::string(utf8_size(content), underscore) + "\n";
-			}
+		result += ": ";
+		StringView target = own_references.target(number);
+		result.append(target.data(), target.size());
+		result += '\n';
+	}
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::write_result(bool finishing)
+{
+	write_output(result.data(), result.size(), finishing);
+	result.clear();
+}
+
+template<class Options>
+void Html2MarkProcessor<Options>::write_output(const char * data, size_t size, bool finishing)
+{
+	Clock::time_point time;
+	if(stats) {
+		time = Clock::now();
+	}
+	if(colors()) {
+		color_normalizer.process(data, size, colored);
+		if(finishing) {
+			color_normalizer.finish(colored);
 		}
-		if(colors()) {
-			return "\n" + PURPLE + std::string(level, '#') +  " " + content + RESET + "\n";
-		} else {
-			return "\n" + std::string(level, '#') +  " " + content + "\n";
+		data = colored.data();
+		size = colored.size();
+		if(stats) {
+			lap(time, stats->color_time);
 		}
-	} else if(value.tag == "a") {
-		if(value.attrs.count("href") == 0) {
-			return value.content;
+	}
+	if(options.has(WRAP)) {
+		line_wrapper.process(data, size, wrapped);
+		if(finishing) {
+			line_wrapper.finish(wrapped);
 		}
-		std::string src = value.attrs.at("href");
-		if(value.attrs.count("title")) {
-			src += " \"" + value.attrs.at("title") + '"';
+		data = wrapped.data();
+		size = wrapped.size();
+		if(stats) {
+			lap(time, stats->wrap_time);
 		}
-		bool is_too_long = value.attrs.at("href").size() > min_reference_links_length;
-		std::string content = value.content;
-		if(options & MAKE_REFERENCE_LINKS && is_too_long) {
-			unsigned ref_number = (unsigned)references.size() + 1;
-			references.emplace_back(ref_number, src);
-			if(colors()) {
-				std::string templ = BLUE + "{0}" + RESET + GREEN + "[{1}]" + RESET;
-				return Chthon::format(templ, content, ref_number);
-			} else {
-				return Chthon::format("[{0}][{1}]", content, ref_number);
-			}
-		} else {
-			if(colors()) {
-				std::string templ = BLUE + "{0}" + RESET + GREEN + "({1})" + RESET;
-				return Chthon::format(templ, content, src);
-			} else {
-				return Chthon::format("[{0}]({1})", content, src);
-			}
+	}
+	if(stats) {
+		stats->peak_buffer_size = std::max(stats->peak_buffer_size, size);
+	}
+	if(exceeds_output_limit(size)) {
+		output_too_large = true;
+	} else if(size > 0) {
+		(*sink)(data, size);
+		output_size += size;
+		if(stats) {
+			stats->output_size += size;
 		}
-	} else if(value.tag == "pre") {
-		std::vector<std::string> lines;
-		Chthon::split(value.content, lines);
-		std::string content;
-		for(const std::string & line : lines) {
-			content += "\n\t" + line;
-		}
-		return content + "\n";
-	} else if(value.tag == "blockquote") {
-		std::vector<std::string> lines;
-		Chthon::split(value.content, lines);
-		std::string content;
-		for(const std::string & line : lines) {
-			if(colors()) {
-				content += "\n" + YELLOW + ">" + RESET + " " + line;
-			} else {
-				content += "\n> " + line;
-			}
+	}
+	colored.clear();
+	wrapped.clear();
+}
+
+// Common combinations of options (the defaults of the library
+// and of the command line) get processors made for them.
+static Processor * make_processor(int options, size_t min_reference_links_length,
+		size_t wrap_width, const Limits & limits)
+{
+	const int common = UNDERSCORED_HEADINGS | MAKE_REFERENCE_LINKS;
+	switch(options) {
+		case DEFAULT_OPTIONS:
+			return new Html2MarkProcessor<FixedOptions<DEFAULT_OPTIONS>>(options,
+					min_reference_links_length, wrap_width, limits);
+		case common:
+			return new Html2MarkProcessor<FixedOptions<common>>(options,
+					min_reference_links_length, wrap_width, limits);
+		case common | COLORS:
+			return new Html2MarkProcessor<FixedOptions<common | COLORS>>(options,
+					min_reference_links_length, wrap_width, limits);
+		case common | WRAP:
+			return new Html2MarkProcessor<FixedOptions<common | WRAP>>(options,
+					min_reference_links_length, wrap_width, limits);
+		case common | COLORS | WRAP:
+			return new Html2MarkProcessor<FixedOptions<common | COLORS | WRAP>>(options,
+					min_reference_links_length, wrap_width, limits);
+		default:
+			return new Html2MarkProcessor<RuntimeOptions>(options,
+					min_reference_links_length, wrap_width, limits);
+	}
+}
+
+std::string html2mark(const std::string & html, int options,
+		size_t min_reference_links_length, size_t wrap_width, Stats * stats)
+{
+	return html2mark(StringView(html), options, min_reference_links_length, wrap_width, stats);
+}
+
+std::string html2mark(std::istream & input, int options,
+		size_t min_reference_links_length, size_t wrap_width, Stats * stats)
+{
+	std::string result;
+	html2mark(input, [&result](const char * data, size_t size) {
+			result.append(data, size);
+			}, options, min_reference_links_length, wrap_width, stats);
+	return result;
+}
+
+std::string html2mark(const StringView & html, int options,
+		size_t min_reference_links_length, size_t wrap_width, Stats * stats)
+{
+	std::string result;
+	html2mark(html, [&result](const char * data, size_t size) {
+			result.append(data, size);
+			}, options, min_reference_links_length, wrap_width, stats);
+	return result;
+}
+
+void html2mark(const std::string & html, const Sink & sink, int options,
+		size_t min_reference_links_length, size_t wrap_width, Stats * stats)
+{
+	html2mark(StringView(html), sink, options, min_reference_links_length, wrap_width, stats);
+}
+
+// The stream is converted as it is read, so only the open top-level
+// block is kept in memory, not the whole document.
+void html2mark(std::istream & input, const Sink & sink, int options,
+		size_t min_reference_links_length, size_t wrap_width, Stats * stats)
+{
+	PushConverter converter(sink, options, min_reference_links_length, wrap_width);
+	converter.collect_stats(stats);
+	std::vector<char> buffer(64 * 1024);
+	while(input.read(buffer.data(), std::streamsize(buffer.size())) || input.gcount() > 0) {
+		converter.feed(buffer.data(), size_t(input.gcount()));
+	}
+	converter.finish();
+}
+
+void html2mark(const StringView & html, const Sink & sink, int options,
+		size_t min_reference_links_length, size_t wrap_width, Stats * stats)
+{
+	Converter(options, min_reference_links_length, wrap_width).convert(html, sink, stats);
+}
+
+Converter::Converter(int options, size_t min_reference_links_length, size_t wrap_width,
+		const Limits & limits)
+	: processor(make_processor(options, min_reference_links_length, wrap_width, limits)),
+	cache(nullptr),
+	cache_settings(make_settings_key(options, min_reference_links_length, wrap_width, limits))
+{}
+
+Converter::~Converter()
+{}
+
+void Converter::use_cache(ResultCache * result_cache)
+{
+	cache = result_cache;
+}
+
+// Gives the cached result to the sink, or converts the document
+// and keeps the output to be added to the cache if it is complete.
+// A cached result is not measured beyond its size and time.
+static Status convert_cached(ResultCache & cache, const CacheKey & settings,
+		const StringView & html, const Sink & sink, std::string & output, Stats * stats,
+		const std::function<Status(const Sink &)> & convert)
+{
+	Clock::time_point start_time;
+	if(stats) {
+		start_time = Clock::now();
+	}
+	CacheKey key = make_cache_key(html, settings);
+	size_t output_size = 0;
+	bool found = cache.find(key, [&sink, &output_size](const char * data, size_t size) {
+			output_size += size;
+			sink(data, size);
+			});
+	if(found) {
+		if(stats) {
+			*stats = Stats();
+			stats->input_size = html.size();
+			stats->output_size = output_size;
+			lap(start_time, stats->total_time);
 		}
-		return content + "\n";
+		return CONVERTED;
 	}
-	return Chthon::format("<{0}>{1}</{0}>", value.tag, value.content);
+	output.clear();
+	Status status = convert([&sink, &output](const char * data, size_t size) {
+			output.append(data, size);
+			sink(data, size);
+			});
+	if(status == CONVERTED) {
+		cache.add(key, output);
+	}
+	return status;
 }
 
-void Html2MarkProcessor::add_content(const std::string & content)
+Status Converter::convert(const StringView & html, std::string & out, Stats * stats)
 {
-	if(parts.empty()) {
-		result += content;
-	} else {
-		parts.back().content += content;
+	out.clear();
+	return convert(html, [&out](const char * data, size_t size) {
+			out.append(data, size);
+			}, stats);
+}
+
+Status Converter::convert(const StringView & html, const Sink & sink, Stats * stats)
+{
+	if(!cache) {
+		return processor->process(html, sink, stats);
 	}
+	return convert_cached(*cache, cache_settings, html, sink, cached_output, stats,
+			[this, &html, stats](const Sink & output_sink) {
+			return processor->process(html, output_sink, stats);
+			});
+}
+
+PushConverter::PushConverter(const Sink & output_sink, int options,
+		size_t min_reference_links_length, size_t wrap_width, const Limits & limits)
+	: sink(output_sink),
+	processor(make_processor(options, min_reference_links_length, wrap_width, limits)),
+	stats(nullptr), retry_size(0), started(false)
+{}
+
+PushConverter::~PushConverter()
+{}
+
+void PushConverter::start()
+{
+	processor->start_push(sink, stats);
+	pending.clear();
+	retry_size = 0;
+	started = true;
 }
 
-void Html2MarkProcessor::collapse_tag(const std::string & tag)
+// A token that is much longer than chunks (like a large comment)
+// is tried again only when its pending input has doubled,
+// so it is not scanned from its start on every chunk.
+void PushConverter::feed(const char * data, size_t size)
 {
-	while(!parts.empty()) {
-		TaggedContent value = parts.back();
-		parts.pop_back();
-		add_content(process_tag(value));
-		if(value.tag == tag) {
-			break;
+	if(!started) {
+		start();
+	}
+	if(pending.empty()) {
+		size_t converted = processor->push(StringView(data, size), false);
+		pending.assign(data + converted, size - converted);
+	} else {
+		pending.append(data, size);
+		if(pending.size() < retry_size) {
+			return;
 		}
+		size_t converted = processor->push(pending, false);
+		pending.erase(0, converted);
 	}
+	retry_size = pending.size() * 2;
 }
 
-void Html2MarkProcessor::process()
+Status PushConverter::finish()
 {
-	Chthon::XMLReader reader(stream);
+	if(!started) {
+		start();
+	}
+	processor->push(pending, true);
+	started = false;
+	pending.clear();
+	return processor->finish_push();
+}
 
-	std::string tag = reader.to_next_tag();
-	std::string content = Chthon::collapse_whitespaces(reader.get_current_content());
-	std::map<std::string, std::string> attrs = reader.get_attributes();
-	if(colors()) {
-		result += RESET;
+void PushConverter::collect_stats(Stats * document_stats)
+{
+	stats = document_stats;
+}
+
+// Place where a piece may start: the beginning of a tag.
+struct Boundary {
+	size_t offset;
+	// Targets of references made by tags from here up to the next boundary
+	// and the offset of the tag that collecting stopped at.
+	std::string reference_targets;
+	std::vector<size_t> reference_ends;
+	size_t references_end;
+	// Whether a tag starts exactly here when the whole document is tokenized.
+	bool is_tag_start;
+};
+
+struct ParallelProcessor {
+	ThreadPool pool;
+	const int options;
+	const size_t min_piece_size;
+	const size_t max_references;
+	const size_t max_output_size;
+	std::vector<std::unique_ptr<Processor>> processors; // One per worker.
+	std::unique_ptr<Processor> joiner;
+	// References of the whole document, numbered before pieces are converted.
+	ReferenceIndex references;
+	std::vector<Boundary> boundaries;
+	std::vector<Piece> pieces;
+	std::vector<bool> converted;
+
+	ParallelProcessor(size_t thread_count, int html_options,
+			size_t min_reference_links_length, size_t wrap_width, size_t piece_size,
+			const Limits & limits);
+	Status process(const StringView & html, const Sink & sink);
+	void find_boundaries(const StringView & html, size_t piece_size);
+	void number_references(const StringView & html);
+	void convert_pieces(const StringView & html);
+	Status join_pieces(const StringView & html, const Sink & sink);
+	void add_references(const std::string & targets, const std::vector<size_t> & ends);
+};
+
+ParallelProcessor::ParallelProcessor(size_t thread_count, int html_options,
+		size_t min_reference_links_length, size_t wrap_width, size_t piece_size,
+		const Limits & limits)
+	: pool(thread_count), options(html_options), min_piece_size(piece_size),
+	max_references(limits.max_references), max_output_size(limits.max_output_size),
+	joiner(make_processor(html_options, min_reference_links_length, wrap_width, limits))
+{
+	for(size_t i = 0; i < pool.size(); ++i) {
+		processors.emplace_back(make_processor(options,
+					min_reference_links_length, wrap_width, limits));
 	}
-	result += content;
-	auto is_in_tag = [this,&tag](const std::string & tag_name) {
-		return tag == tag_name || has_tag(this->parts, tag_name);
-	};
-	while(!tag.empty()) {
-		reader.to_next_tag();
-		content = reader.get_current_content();
-		bool keep_whitespaces = is_in_tag("pre") || is_in_tag("code");
-		if(!keep_whitespaces) {
-			content = Chthon::collapse_whitespaces(content);
-			bool keep_border_spaces = is_in_tag("i") || is_in_tag("em")
-				|| is_in_tag("b") || is_in_tag("strong");
-			if(!keep_border_spaces && content != " ") {
-				content = Chthon::trim_left(content);
-			}
+}
+
+// Targets that are already there keep their numbers.
+// Targets over the limit do not make references.
+void ParallelProcessor::add_references(const std::string & targets, const std::vector<size_t> & ends)
+{
+	size_t start = 0;
+	for(size_t end : ends) {
+		StringView target(targets.data() + start, end - start);
+		start = end;
+		if(references.find(target) == 0 && (max_references == 0 || references.size() < max_references)) {
+			references.add(target);
 		}
+	}
+}
 
-		if(Chthon::starts_with(tag, "/")) {
-			std::string open_tag = tag.substr(1);
-			if(has_tag(parts, open_tag)) {
-				collapse_tag(open_tag);
-			}
-			if(Chthon::starts_with(open_tag, "h") || open_tag == "p") {
-				add_content(Chthon::trim(content));
-			} else {
-				add_content(content);
-			}
-		} else if(tag == "code") {
-			if(!parts.empty() && parts.back().tag == "pre" && parts.back().content.empty()) {
-				parts.back().content = content;
-			} else {
-				parts.emplace_back(tag, content, attrs);
-			}
-		} else if(tag == "ol" || tag == "ul") {
-			lists.push_back(List(tag == "ol"));
-			parts.emplace_back(tag, content, attrs);
-		} else if(tag == "li") {
-			bool list_found = false, li_found = false;
-			for(const TaggedContent & part : parts) {
-				if(part.tag == "ol" || part.tag == "ul") {
-					list_found = true;
-					li_found = false;
-				} else if(part.tag == "li") {
-					if(list_found) {
-						li_found = true;
-					}
-				}
-			}
-			if(li_found) {
-				collapse_tag("li");
-			}
-			parts.emplace_back(tag, content, attrs);
-		} else if(tag == "p") {
-			bool found = false;
-			for(const TaggedContent & value : parts) {
-				if(value.tag == "p") {
-					found = true;
-					break;
-				}
-			}
-			if(found) {
-				collapse_tag("p");
-			}
-			parts.emplace_back(tag, content, attrs);
-		} else if(Chthon::starts_with(tag, "hr")) {
-			if(colors()) {
-				add_content("\n" + PURPLE + "* * *" + RESET + "\n");
-			} else {
-				add_content("\n* * *\n");
-			}
-			add_content(content);
-		} else if(Chthon::starts_with(tag, "br")) {
-			add_content("\n");
-			add_content(content);
-		} else if(tag == "img") {
-			std::string src = attrs["src"];
-			if(attrs.count("title")) {
-				src += " \"" + attrs["title"] + '"';
-			}
-			bool is_too_long = attrs["src"].size() > min_reference_links_length;
-			if(options & MAKE_REFERENCE_LINKS && is_too_long) {
-				unsigned ref_number = (unsigned)references.size() + 1;
-				references.emplace_back(ref_number, src);
-				if(colors()) {
-					std::string templ = BLUE + "![{0}]" + RESET + GREEN + "[{1}]" + RESET;
-					add_content(Chthon::format(templ, attrs["alt"], ref_number));
-				} else {
-					add_content(Chthon::format("![{0}][{1}]", attrs["alt"], ref_number));
-				}
-			} else {
-				if(colors()) {
-					std::string templ = BLUE + "![{0}]" + RESET + GREEN + "({1})" + RESET;
-					add_content(Chthon::format(templ, attrs["alt"], src));
-				} else {
-					add_content(Chthon::format("![{0}]({1})", attrs["alt"], src));
-				}
-			}
-			add_content(content);
+static bool is_tag_start(const char * pos, const char * end)
+{
+	return pos + 1 < end && *pos == '<' && (('a' <= pos[1] && pos[1] <= 'z') || ('A' <= pos[1] && pos[1] <= 'Z'));
+}
+
+// Boundaries are opening tags about piece_size apart.
+// The last one is the end of the document.
+void ParallelProcessor::find_boundaries(const StringView & html, size_t piece_size)
+{
+	boundaries.clear();
+	Boundary boundary = Boundary();
+	boundaries.push_back(boundary);
+	const char * end = html.end();
+	const char * pos = html.begin() + piece_size;
+	while(pos < end) {
+		pos = find_char(pos, end, '<');
+		if(pos == end) {
+			break;
+		}
+		if(is_tag_start(pos, end)) {
+			boundary.offset = size_t(pos - html.begin());
+			boundaries.push_back(boundary);
+			pos += std::min(piece_size, size_t(end - pos));
 		} else {
-			parts.emplace_back(tag, content, attrs);
+			++pos;
 		}
+	}
+	boundary.offset = html.size();
+	boundaries.push_back(boundary);
+}
 
-		tag = reader.get_current_tag();
-		attrs = reader.get_attributes();
+// Collects references between boundaries in parallel, then follows the tags
+// through the document to find which boundaries are real tag starts
+// and numbers the references in the order they are made.
+// Where a tag crosses a boundary (e.g. comment or script with markup in it),
+// collecting goes on from the end of that tag up to the next boundary.
+void ParallelProcessor::number_references(const StringView & html)
+{
+	size_t count = boundaries.size() - 1;
+	for(size_t index = 0; index < count; ++index) {
+		pool.submit([this, &html, index](size_t worker) {
+				Boundary & boundary = boundaries[index];
+				boundary.references_end = processors[worker]->collect_references(html,
+						boundary.offset, boundaries[index + 1].offset,
+						boundary.reference_targets, boundary.reference_ends);
+				});
 	}
-	collapse_tag();
-	if(!references.empty()) {
-		result += "\n\n";
-		for(auto ref : references) {
-			if(colors()) {
-				std::string templ = GREEN + "[{0}]" + RESET + ": {1}\n";
-				result += Chthon::format(templ, ref.first, ref.second);
-			} else {
-				result += Chthon::format("[{0}]: {1}\n", ref.first, ref.second);
-			}
-		}
+	pool.wait();
+	for(Boundary & boundary : boundaries) {
+		boundary.is_tag_start = false;
 	}
-	if(colors()) {
-		size_t pos = 0;
-		std::vector<std::string> color_stack;
-		while((pos = result.find(ESCAPE, pos + 1)) != std::string::npos) {
-			if(result.substr(pos, 4) != RESET) {
-				color_stack.push_back(result.substr(pos, 8));
-				continue;
-			}
-			if(color_stack.empty()) {
-				result.erase(pos, 4);
-				--pos;
-				continue;
-			}
-			color_stack.pop_back();
-			if(!color_stack.empty()) {
-				result.replace(pos, 4, color_stack.back());
-			}
+	references.clear();
+	std::string targets;
+	std::vector<size_t> ends;
+	size_t index = 0;
+	while(index < count) {
+		Boundary & boundary = boundaries[index];
+		boundary.is_tag_start = true;
+		add_references(boundary.reference_targets, boundary.reference_ends);
+		size_t position = boundary.references_end;
+		while(boundaries[index].offset < position) {
+			++index;
 		}
-		pos = 0;
-		while((pos = result.find(ESCAPE, pos + 1)) != std::string::npos) {
-			size_t len = (result.substr(pos, 4) == RESET) ? 4 : 8;
-			if(pos + len < result.size() && result[pos + len] == ESCAPE) {
-				result.erase(pos, len);
-				--pos;
+		while(boundaries[index].offset != position) {
+			position = processors[0]->collect_references(html, position,
+					boundaries[index].offset, targets, ends);
+			add_references(targets, ends);
+			while(boundaries[index].offset < position) {
+				++index;
 			}
 		}
-		if(!Chthon::ends_with(result, RESET)) {
-			result += RESET;
+	}
+}
+
+// Each piece goes from its boundary up to the next boundary that is a tag start.
+// A piece is only of use if all elements are closed at both its ends.
+void ParallelProcessor::convert_pieces(const StringView & html)
+{
+	size_t count = boundaries.size() - 1;
+	pieces.resize(count);
+	converted.assign(count, false);
+	size_t index = 0;
+	while(index < count) {
+		size_t next = index + 1;
+		while(next < count && !boundaries[next].is_tag_start) {
+			++next;
 		}
+		converted[index] = true;
+		pool.submit([this, &html, index, next](size_t worker) {
+				processors[worker]->process_piece(html, boundaries[index].offset,
+						boundaries[next].offset, false, references, false, pieces[index]);
+				});
+		index = next;
 	}
-	if(options & WRAP) {
-		size_t pos = 0;
-		std::string last_escape_seq;
-		std::string last_escape_seq_before_space;
-		while(pos < result.size()) {
-			size_t last_pos = pos;
-			size_t last_space = std::string::npos;
-			int virtual_width = 0;
-			while(pos < result.size() && int(pos - last_pos) + virtual_width <= int(wrap_width)) {
-				if(result[pos] == ' ') {
-					last_escape_seq_before_space = last_escape_seq;
-					last_space = pos;
-					++pos;
-				} else if(result[pos] == '\n') {
-					if(!last_escape_seq.empty() && last_escape_seq != RESET) {
-						result.replace(pos, 1, RESET + '\n' + last_escape_seq);
-						pos = pos + RESET.size() + last_escape_seq.size();
-					}
-					last_pos = pos + 1;
-					last_space = std::string::npos;
-					virtual_width = 0;
-					++pos;
-				} else if(result[pos] == '\t') {
-					virtual_width += 7;
-					++pos;
-				} else if(result[pos] == ESCAPE) {
-					int len = (result.substr(pos, 4) == RESET) ? 4 : 8;
-					last_escape_seq = result.substr(pos, size_t(len));
-					virtual_width -= len;
-					pos += unsigned(len);
-				} else {
-					++pos;
-					bool is_utf8 = (result[pos] & 0xc0) == 0x80;
-					if(is_utf8) {
-						++pos;
-						--virtual_width;
-					}
-				}
-			}
-			if(pos >= result.size()) {
+	pool.wait();
+}
+
+// Goes through the document from one point where all elements are closed
+// to another, taking converted pieces where they fit; the rest of the document
+// is converted on this thread up to a point where all elements are closed.
+// A piece is not taken if its reference numbers do not follow the ones
+// already written: collecting does not know about tags that are ignored
+// for being too deep or links that are closed by other tags.
+Status ParallelProcessor::join_pieces(const StringView & html, const Sink & sink)
+{
+	size_t count = boundaries.size() - 1;
+	Piece piece;
+	joiner->start_output(sink);
+	size_t position = 0;
+	size_t index = 0;
+	while(position < html.size()) {
+		while(boundaries[index].offset < position) {
+			++index;
+		}
+		bool at_boundary = boundaries[index].offset == position;
+		if(at_boundary && index < count && converted[index] && pieces[index].complete
+				&& joiner->take_references(pieces[index])) {
+			if(!joiner->write_piece(pieces[index])) {
 				break;
 			}
-			if(last_space != std::string::npos) {
-				last_escape_seq = last_escape_seq_before_space;
-				if(!last_escape_seq.empty() && last_escape_seq != RESET) {
-					result.replace(last_space, 1, RESET + '\n' + last_escape_seq);
-					pos = last_space + 1 + RESET.size() + last_escape_seq.size();
-				} else {
-					result[last_space] = '\n';
-					pos = last_space + 1;
-				}
-			} else {
-				if(!last_escape_seq.empty() && last_escape_seq != RESET) {
-					result.insert(pos - 1, RESET + '\n' + last_escape_seq);
-					pos = pos + RESET.size() + last_escape_seq.size();
-				} else {
-					result.insert(pos - 1, "\n");
-				}
-			}
+			position = pieces[index].end;
+			continue;
 		}
+		size_t limit = boundaries[at_boundary ? index + 1 : index].offset;
+		processors[0]->process_piece(html, position, limit, true,
+				joiner->reference_index(), true, piece);
+		if(!joiner->write_piece(piece)) {
+			break;
+		}
+		position = piece.end;
 	}
+	return joiner->finish_output();
 }
 
-std::string html2mark(const std::string & html, int options,
-		size_t min_reference_links_length, size_t wrap_width)
+// Output that is cut by the size limit has to end at the same block
+// as the one of a single thread, which pieces do not know about,
+// so such documents are converted on one thread.
+Status ParallelProcessor::process(const StringView & html, const Sink & sink)
+{
+	if(max_output_size > 0) {
+		return joiner->process(html, sink);
+	}
+	size_t piece_size = std::max(min_piece_size, html.size() / (4 * pool.size()));
+	find_boundaries(html, piece_size);
+	if(boundaries.size() <= 2) {
+		return joiner->process(html, sink);
+	}
+	if(options & MAKE_REFERENCE_LINKS) {
+		number_references(html);
+	} else {
+		references.clear();
+		for(Boundary & boundary : boundaries) {
+			boundary.is_tag_start = true;
+		}
+	}
+	convert_pieces(html);
+	return join_pieces(html, sink);
+}
+
+ParallelConverter::ParallelConverter(size_t thread_count, int options,
+		size_t min_reference_links_length, size_t wrap_width, size_t min_piece_size,
+		const Limits & limits)
+	: processor(new ParallelProcessor(thread_count, options,
+				min_reference_links_length, wrap_width, min_piece_size, limits)),
+	cache(nullptr),
+	cache_settings(make_settings_key(options, min_reference_links_length, wrap_width, limits))
+{}
+
+ParallelConverter::~ParallelConverter()
+{}
+
+void ParallelConverter::use_cache(ResultCache * result_cache)
 {
-	std::istringstream input(html);
-	Html2MarkProcessor processor(input, options, min_reference_links_length, wrap_width);
-	processor.process();
-	return processor.get_result();
+	cache = result_cache;
 }
 
-std::string html2mark(std::istream & input, int options,
-		size_t min_reference_links_length, size_t wrap_width)
+Status ParallelConverter::convert(const StringView & html, std::string & out)
 {
-	Html2MarkProcessor processor(input, options, min_reference_links_length, wrap_width);
-	processor.process();
-	return processor.get_result();
+	out.clear();
+	return convert(html, [&out](const char * data, size_t size) {
+			out.append(data, size);
+			});
+}
+
+Status ParallelConverter::convert(const StringView & html, const Sink & sink)
+{
+	if(!cache) {
+		return processor->process(html, sink);
+	}
+	return convert_cached(*cache, cache_settings, html, sink, cached_output, nullptr,
+			[this, &html](const Sink & output_sink) {
+			return processor->process(html, output_sink);
+			});
 }
 
 }
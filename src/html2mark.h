@@ -1,6 +1,10 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <istream>
+#include <functional>
+#include <memory>
+#include "string_view.h"
 
 namespace Html2Mark {
 
@@ -13,9 +17,169 @@ enum {
 	COUNT = 0x100
 };
 
+// Limits for input that cannot be trusted. Zero means no limit.
+struct Limits {
+	// Tags of elements that would be nested deeper are ignored,
+	// their text is kept.
+	size_t max_depth;
+	// Conversion stops with OUTPUT_TOO_LARGE when output, or text that is
+	// kept for output, would grow beyond it. Content of elements that are
+	// not shown (head, script, style) is not counted. Output that was already
+	// given to the sink is not longer than the limit and ends at a top-level block.
+	size_t max_output_size;
+	// Links to new targets after that many references are written inline.
+	size_t max_references;
+	// Longer attribute values are ignored as if the attribute was not there.
+	size_t max_attribute_size;
+
+	Limits();
+};
+
+enum Status {
+	CONVERTED,
+	OUTPUT_TOO_LARGE
+};
+
+// What a conversion took. Filled in only when asked for,
+// otherwise nothing is measured or counted.
+struct Stats {
+	// Wall time of conversion phases, in seconds.
+	double total_time;
+	double tokenize_time;
+	double render_time;
+	double color_time;
+	double wrap_time;
+	size_t tokens;
+	size_t elements;
+	size_t max_depth;
+	size_t references; // Distinct link targets.
+	size_t input_size;
+	size_t output_size;
+	size_t peak_buffer_size;
+
+	Stats();
+	// Sums up stats of several conversions; depth and buffer size are maximums.
+	void add(const Stats & other);
+};
+
+// Receives converted output piece by piece, as soon as each top-level block
+// is closed. The data is only valid for the duration of the call.
+typedef std::function<void(const char * data, size_t size)> Sink;
+
 std::string html2mark(const std::string & html, int options = DEFAULT_OPTIONS,
-		size_t min_reference_links_length = 20, size_t wrap_width = 80);
+		size_t min_reference_links_length = 20, size_t wrap_width = 80,
+		Stats * stats = nullptr);
 std::string html2mark(std::istream & input, int options = DEFAULT_OPTIONS,
-		size_t min_reference_links_length = 20, size_t wrap_width = 80);
+		size_t min_reference_links_length = 20, size_t wrap_width = 80,
+		Stats * stats = nullptr);
+// Converts HTML that is already in memory without copying it.
+std::string html2mark(const StringView & html, int options = DEFAULT_OPTIONS,
+		size_t min_reference_links_length = 20, size_t wrap_width = 80,
+		Stats * stats = nullptr);
+
+void html2mark(const std::string & html, const Sink & sink,
+		int options = DEFAULT_OPTIONS,
+		size_t min_reference_links_length = 20, size_t wrap_width = 80,
+		Stats * stats = nullptr);
+void html2mark(std::istream & input, const Sink & sink,
+		int options = DEFAULT_OPTIONS,
+		size_t min_reference_links_length = 20, size_t wrap_width = 80,
+		Stats * stats = nullptr);
+void html2mark(const StringView & html, const Sink & sink,
+		int options = DEFAULT_OPTIONS,
+		size_t min_reference_links_length = 20, size_t wrap_width = 80,
+		Stats * stats = nullptr);
+
+struct Processor;
+class ResultCache;
+
+// Identifies a conversion in a ResultCache (see result_cache.h).
+struct CacheKey {
+	uint64_t low, high;
+	bool operator==(const CacheKey & other) const { return low == other.low && high == other.high; }
+};
+
+// Converts many documents with the same settings.
+// Internal buffers and stacks are kept between conversions,
+// so once a few documents have been converted, next ones of similar
+// size and nesting are converted without growing the heap.
+class Converter {
+public:
+	Converter(int options = DEFAULT_OPTIONS,
+			size_t min_reference_links_length = 20, size_t wrap_width = 80,
+			const Limits & limits = Limits());
+	~Converter();
+	// Replaces the content of out, reusing its capacity.
+	Status convert(const StringView & html, std::string & out, Stats * stats = nullptr);
+	Status convert(const StringView & html, const Sink & sink, Stats * stats = nullptr);
+	// Results are looked up in the cache before converting and added to it after.
+	// The cache has to outlive the converter; nullptr stops caching.
+	void use_cache(ResultCache * result_cache);
+private:
+	Converter(const Converter &);
+	Converter & operator=(const Converter &);
+	std::unique_ptr<Processor> processor;
+	ResultCache * cache;
+	const CacheKey cache_settings;
+	std::string cached_output;
+};
+
+// Converts a document that comes in chunks, e.g. from a socket,
+// without waiting for all of it. Chunks may end anywhere, also inside
+// of tags or UTF-8 sequences: only the incomplete token at the end
+// of a chunk is kept until the next one. Output goes to the sink
+// as soon as top-level blocks are closed.
+class PushConverter {
+public:
+	// The sink is called from feed() and finish().
+	PushConverter(const Sink & sink, int options = DEFAULT_OPTIONS,
+			size_t min_reference_links_length = 20, size_t wrap_width = 80,
+			const Limits & limits = Limits());
+	~PushConverter();
+	void feed(const char * data, size_t size);
+	// Converts the rest of the document and writes its references.
+	// The next call to feed() starts another document.
+	Status finish();
+	// Stats of documents that are started from now on are collected there,
+	// they are complete after finish(); nullptr stops collecting them.
+	void collect_stats(Stats * document_stats);
+private:
+	PushConverter(const PushConverter &);
+	PushConverter & operator=(const PushConverter &);
+	void start();
+	const Sink sink;
+	std::unique_ptr<Processor> processor;
+	Stats * stats;
+	std::string pending; // Start of the token that is not complete yet.
+	size_t retry_size; // Size of pending input worth trying again.
+	bool started;
+};
+
+struct ParallelProcessor;
+
+// Converts large documents on several threads.
+// The document is cut at points where all elements are closed,
+// pieces are converted in parallel and joined with their references
+// renumbered, so the output is the same as the one of Converter.
+// Documents that are too small to be cut are converted on one thread,
+// as well as all documents when Limits::max_output_size is set.
+class ParallelConverter {
+public:
+	ParallelConverter(size_t thread_count, int options = DEFAULT_OPTIONS,
+			size_t min_reference_links_length = 20, size_t wrap_width = 80,
+			size_t min_piece_size = 64 * 1024, const Limits & limits = Limits());
+	~ParallelConverter();
+	Status convert(const StringView & html, std::string & out);
+	Status convert(const StringView & html, const Sink & sink);
+	// See Converter::use_cache().
+	void use_cache(ResultCache * result_cache);
+private:
+	ParallelConverter(const ParallelConverter &);
+	ParallelConverter & operator=(const ParallelConverter &);
+	std::unique_ptr<ParallelProcessor> processor;
+	ResultCache * cache;
+	const CacheKey cache_settings;
+	std::string cached_output;
+};
 
 }
@@ -0,0 +1,101 @@
+#include "html2mark_c.h"
+#include "html2mark.h"
+#include <cstring>
+#include <new>
+
+struct html2mark_converter {
+	Html2Mark::Converter converter;
+	std::string output;
+	int status;
+
+	html2mark_converter(int options, size_t min_reference_links_length, size_t wrap_width,
+			const Html2Mark::Limits & limits)
+		: converter(options, min_reference_links_length, wrap_width, limits),
+		status(HTML2MARK_OK)
+	{}
+};
+
+static const int KNOWN_OPTIONS = HTML2MARK_UNDERSCORED_HEADINGS
+	| HTML2MARK_MAKE_REFERENCE_LINKS | HTML2MARK_COLORS | HTML2MARK_WRAP;
+
+static_assert(HTML2MARK_UNDERSCORED_HEADINGS == Html2Mark::UNDERSCORED_HEADINGS
+		&& HTML2MARK_MAKE_REFERENCE_LINKS == Html2Mark::MAKE_REFERENCE_LINKS
+		&& HTML2MARK_COLORS == Html2Mark::COLORS
+		&& HTML2MARK_WRAP == Html2Mark::WRAP,
+		"options of the C interface should be the same as in html2mark.h");
+
+int html2mark_abi_version(void)
+{
+	return HTML2MARK_ABI_VERSION;
+}
+
+html2mark_converter * html2mark_create(int options,
+		size_t min_reference_links_length, size_t wrap_width,
+		const html2mark_limits * limits)
+{
+	if((options & ~KNOWN_OPTIONS) != 0 || ((options & HTML2MARK_WRAP) != 0 && wrap_width == 0)) {
+		return nullptr;
+	}
+	Html2Mark::Limits converter_limits;
+	if(limits != nullptr) {
+		converter_limits.max_depth = limits->max_depth;
+		converter_limits.max_output_size = limits->max_output_size;
+		converter_limits.max_references = limits->max_references;
+		converter_limits.max_attribute_size = limits->max_attribute_size;
+	}
+	try {
+		return new html2mark_converter(options, min_reference_links_length, wrap_width,
+				converter_limits);
+	} catch(...) {
+		return nullptr;
+	}
+}
+
+int html2mark_convert(html2mark_converter * converter,
+		const char * html, size_t html_size,
+		char * out, size_t out_capacity, size_t * out_size)
+{
+	if(converter == nullptr || (html == nullptr && html_size > 0)
+			|| (out == nullptr && out_capacity > 0) || out_size == nullptr) {
+		return HTML2MARK_INVALID_ARGUMENT;
+	}
+	*out_size = 0;
+	converter->output.clear();
+	converter->status = HTML2MARK_OK;
+	try {
+		Html2Mark::Status status = converter->converter.convert(
+				Html2Mark::StringView(html, html_size), converter->output);
+		converter->status = status == Html2Mark::CONVERTED
+			? HTML2MARK_OK : HTML2MARK_OUTPUT_TOO_LARGE;
+	} catch(const std::bad_alloc &) {
+		converter->output.clear();
+		return HTML2MARK_OUT_OF_MEMORY;
+	} catch(...) {
+		converter->output.clear();
+		return HTML2MARK_INTERNAL_ERROR;
+	}
+	*out_size = converter->output.size();
+	if(converter->output.size() > out_capacity) {
+		return HTML2MARK_BUFFER_TOO_SMALL;
+	}
+	if(!converter->output.empty()) {
+		memcpy(out, converter->output.data(), converter->output.size());
+	}
+	return converter->status;
+}
+
+int html2mark_output(const html2mark_converter * converter,
+		const char ** out, size_t * out_size)
+{
+	if(converter == nullptr || out == nullptr || out_size == nullptr) {
+		return HTML2MARK_INVALID_ARGUMENT;
+	}
+	*out = converter->output.data();
+	*out_size = converter->output.size();
+	return converter->status;
+}
+
+void html2mark_free(html2mark_converter * converter)
+{
+	delete converter;
+}
@@ -0,0 +1,89 @@
+#ifndef HTML2MARK_C_H
+#define HTML2MARK_C_H
+#include <stddef.h>
+
+/* C interface of libhtml2mark.
+ * Functions never let exceptions out and report errors by status codes.
+ * A converter keeps its buffers between conversions, so it should be
+ * created once and reused; it may be used by one thread at a time.
+ */
+
+#if defined(__GNUC__)
+#define HTML2MARK_API __attribute__((visibility("default")))
+#else
+#define HTML2MARK_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Incremented when existing declarations change incompatibly. */
+#define HTML2MARK_ABI_VERSION 1
+
+/* Options, the same as in html2mark.h. */
+#define HTML2MARK_UNDERSCORED_HEADINGS 0x01
+#define HTML2MARK_MAKE_REFERENCE_LINKS 0x02
+#define HTML2MARK_COLORS 0x04
+#define HTML2MARK_WRAP 0x08
+
+enum html2mark_status {
+	HTML2MARK_OK = 0,
+	/* Output was cut by max_output_size; the part that was made is returned. */
+	HTML2MARK_OUTPUT_TOO_LARGE = 1,
+	/* Output did not fit into the buffer; nothing was written to it. */
+	HTML2MARK_BUFFER_TOO_SMALL = 2,
+	HTML2MARK_INVALID_ARGUMENT = 3,
+	HTML2MARK_OUT_OF_MEMORY = 4,
+	HTML2MARK_INTERNAL_ERROR = 5
+};
+
+/* Limits for input that cannot be trusted, see Html2Mark::Limits.
+ * Zero means no limit.
+ */
+typedef struct html2mark_limits {
+	size_t max_depth;
+	size_t max_output_size;
+	size_t max_references;
+	size_t max_attribute_size;
+} html2mark_limits;
+
+typedef struct html2mark_converter html2mark_converter;
+
+/* Returns HTML2MARK_ABI_VERSION of the library that is actually loaded. */
+HTML2MARK_API int html2mark_abi_version(void);
+
+/* Returns a new converter, or NULL if options are unknown or memory is out.
+ * Limits may be NULL. Defaults of the command line tool are
+ * min_reference_links_length 20 and wrap_width 80.
+ */
+HTML2MARK_API html2mark_converter * html2mark_create(int options,
+		size_t min_reference_links_length, size_t wrap_width,
+		const html2mark_limits * limits);
+
+/* Converts html_size bytes of HTML into out, which can take out_capacity bytes.
+ * Output is not terminated by zero. The size of output is stored into out_size
+ * also when it is HTML2MARK_BUFFER_TOO_SMALL, so the call can be repeated
+ * with a larger buffer, or output can be taken by html2mark_output.
+ * out may be NULL when out_capacity is 0.
+ */
+HTML2MARK_API int html2mark_convert(html2mark_converter * converter,
+		const char * html, size_t html_size,
+		char * out, size_t out_capacity, size_t * out_size);
+
+/* Output of the latest conversion, kept by the converter
+ * until the next conversion or until it is freed.
+ * Makes it unnecessary to guess the size of the buffer.
+ * Returns the status of that conversion, HTML2MARK_OK if there was none.
+ */
+HTML2MARK_API int html2mark_output(const html2mark_converter * converter,
+		const char ** out, size_t * out_size);
+
+/* Accepts NULL. */
+HTML2MARK_API void html2mark_free(html2mark_converter * converter);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,61 @@
+#include "io.h"
+#include <poll.h>
+#include <cerrno>
+
+namespace Html2Mark {
+
+bool wait_for_file(int fd, bool for_writing, const Deadline * deadline)
+{
+	pollfd item;
+	item.fd = fd;
+	item.events = for_writing ? POLLOUT : POLLIN;
+	while(true) {
+		int timeout = -1;
+		if(deadline) {
+			auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+					*deadline - std::chrono::steady_clock::now()).count();
+			if(left <= 0) {
+				return false;
+			}
+			timeout = int(left);
+		}
+		item.revents = 0;
+		int ready = poll(&item, 1, timeout);
+		if(ready < 0 && errno == EINTR) {
+			continue;
+		}
+		return ready > 0;
+	}
+}
+
+bool write_all(int fd, struct iovec * parts, int count, const Deadline * deadline)
+{
+	while(count > 0) {
+		ssize_t written = writev(fd, parts, count);
+		if(written < 0 && errno == EINTR) {
+			continue;
+		}
+		if(written < 0 && errno == EAGAIN) {
+			if(!wait_for_file(fd, true, deadline)) {
+				return false;
+			}
+			continue;
+		}
+		if(written < 0) {
+			return false;
+		}
+		size_t left = size_t(written);
+		while(count > 0 && left >= parts->iov_len) {
+			left -= parts->iov_len;
+			++parts;
+			--count;
+		}
+		if(count > 0) {
+			parts->iov_base = static_cast<char *>(parts->iov_base) + left;
+			parts->iov_len -= left;
+		}
+	}
+	return true;
+}
+
+}
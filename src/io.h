@@ -0,0 +1,21 @@
+#pragma once
+#include <sys/uio.h>
+#include <chrono>
+
+namespace Html2Mark {
+
+// Time by which reading or writing has to be done.
+typedef std::chrono::steady_clock::time_point Deadline;
+
+// Waits until the file can be read, or written if for_writing is set.
+// Returns false if the deadline passes first; without a deadline
+// waits as long as it takes.
+bool wait_for_file(int fd, bool for_writing, const Deadline * deadline);
+
+// Writes all the parts in order, taking as many calls as the file takes.
+// Interrupted calls are repeated, files that do not block are waited for
+// up to the deadline. Returns false on error or when the deadline passes;
+// the parts are changed to what was not written.
+bool write_all(int fd, struct iovec * parts, int count, const Deadline * deadline = nullptr);
+
+}
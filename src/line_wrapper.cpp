@@ -0,0 +1,125 @@
+#include "line_wrapper.h"
+#include "display_width.h"
+#include "escape_sequence.h"
+
+namespace Html2Mark {
+
+LineWrapper::LineWrapper(size_t line_width, size_t tab_width)
+	: wrap_width(line_width), tab_size(tab_width > 0 ? tab_width : 1),
+	start(0), pos(0), column(0), last_space(std::string::npos)
+{}
+
+void LineWrapper::process(const char * data, size_t size, std::string & out)
+{
+	line.append(data, size);
+	scan(out, false);
+	line.erase(0, start);
+	pos -= start;
+	if(last_space != std::string::npos) {
+		last_space -= start;
+	}
+	start = 0;
+}
+
+void LineWrapper::finish(std::string & out)
+{
+	scan(out, true);
+	out.append(line, start, std::string::npos);
+	line.clear();
+	start = pos = column = 0;
+	last_space = std::string::npos;
+	escape.clear();
+}
+
+void LineWrapper::end_line(std::string & out, const std::string & color)
+{
+	if(!color.empty() && !is_reset_sequence(color.data(), color.size())) {
+		out += RESET_SEQUENCE;
+		out += '\n';
+		out += color;
+	} else {
+		out += '\n';
+	}
+}
+
+void LineWrapper::break_line(std::string & out)
+{
+	if(last_space != std::string::npos) {
+		out.append(line, start, last_space - start);
+		end_line(out, escape_at_space);
+		escape = escape_at_space;
+		start = pos = last_space + 1;
+	} else {
+		out.append(line, start, pos - start);
+		end_line(out, escape);
+		start = pos;
+	}
+	column = 0;
+	last_space = std::string::npos;
+}
+
+void LineWrapper::scan(std::string & out, bool at_end)
+{
+	while(pos < line.size()) {
+		char ch = line[pos];
+		if(ch == '\n') {
+			out.append(line, start, pos - start);
+			end_line(out, escape);
+			start = ++pos;
+			column = 0;
+			last_space = std::string::npos;
+			continue;
+		}
+		if(ch == ESCAPE_CHAR) {
+			size_t size = escape_sequence_size(line.data() + pos, line.data() + line.size());
+			if(size == 0) {
+				if(!at_end) {
+					return;
+				}
+				size = line.size() - pos;
+			}
+			escape.assign(line, pos, size);
+			pos += size;
+			continue;
+		}
+		// Words are measured in bulk while they fit.
+		if(column < wrap_width) {
+			size_t fitted = fit_width(line.data() + pos, line.size() - pos, wrap_width - column, column);
+			if(fitted > 0) {
+				pos += fitted;
+				continue;
+			}
+		}
+		size_t size = utf8_char_size(line.data() + pos, line.size() - pos);
+		if(size == 0) {
+			if(!at_end) {
+				return;
+			}
+			size = line.size() - pos;
+		}
+		size_t width = utf8_char_width(line.data() + pos, size);
+		if(ch == '\t') {
+			width = tab_size - column % tab_size;
+		} else if(ch == ' ') {
+			last_space = pos;
+			escape_at_space = escape;
+		}
+		if(width > 0 && column > 0 && column + width > wrap_width) {
+			break_line(out);
+			continue;
+		}
+		column += width;
+		pos += size;
+	}
+}
+
+std::string wrap_lines(const std::string & text, size_t line_width, size_t tab_width)
+{
+	std::string result;
+	LineWrapper wrapper(line_width, tab_width);
+	wrapper.process(text.data(), text.size(), result);
+	wrapper.finish(result);
+	return result;
+}
+
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <string>
+
+namespace Html2Mark {
+
+// Breaks lines longer than the given width at the last space that fits,
+// or right before the first character that does not fit.
+// Works on any text: UTF-8 characters take as many columns as in a terminal
+// (two for East Asian wide ones, none for combining marks),
+// tabs advance to the next tab stop and escape sequences take no room.
+// If a color is set when a line is broken, it is reset before the break
+// and set again on the next line.
+//
+// Text may be fed in chunks of any size, even splitting a character
+// or an escape sequence; every byte is measured once (or twice,
+// if the line is broken at a space before it), and only the current
+// unfinished line is kept between calls.
+class LineWrapper {
+public:
+	LineWrapper(size_t line_width, size_t tab_width = 8);
+	void process(const char * data, size_t size, std::string & out);
+	void finish(std::string & out);
+private:
+	const size_t wrap_width;
+	const size_t tab_size;
+	std::string line;
+	size_t start;
+	size_t pos;
+	size_t column;
+	size_t last_space;
+	std::string escape;
+	std::string escape_at_space;
+
+	void scan(std::string & out, bool at_end);
+	void break_line(std::string & out);
+	void end_line(std::string & out, const std::string & color);
+};
+
+std::string wrap_lines(const std::string & text, size_t line_width, size_t tab_width = 8);
+
+}
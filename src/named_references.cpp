@@ -0,0 +1,1123 @@
+// Generated by named_references.py, do not edit.
+#include "named_references.h"
+#include <cstdint>
+#include <cstring>
+
+namespace Html2Mark {
+
+namespace {
+	const size_t REFERENCE_COUNT = 2125;
+	const char NAMES[] =
+		"frac35blacktriangleleftintegersthinsplmoustachefrownboxVRswarrLlrlmnleqcsubeyenacyrotimeslmidotsupeu"
+		"umlogonJfrboxDrEquilibriumsupedotAssignesdotdotsquareoslashzhcycupcapboxulsemipertenkncongdotnwarhka"
+		"stUtildeemsp14CcaronNotRightTriangleweierplsaquoUpsilonapedarrngesEumlnexcaptimesbarsqcupsdjcyngtrts"
+		"hcylaquorshminusdunhArrFfrudharNfrcirmidlharuvarsupsetneqlceilcuporlrmrbbrknprecUpdownarrownleqqPrim"
+		"eaacuteGammaogtZscrOverBracebumpegtquestsupdotucyNotLessbprimebdquoAfrCdotvnsubccaronlapgtcirNotSupe"
+		"rsetEqualHopflneswnwarnunotindotlluringIgraveOpenCurlyDoubleQuotescelnapbscrnsubsetlfloorsup3isinsnb"
+		"spDownArrowUpArrowIntleftrightharpoonsThetayumlProportionReverseElementocircVerbarnopfrparnivropfAri"
+		"ngvsubnERightDownVectorBarPrecedesSlantEqualgeqslantgopfTscrthetasymntriangleleftbackepsilonDoubleUp"
+		"DownArrowtosaPiproptolAarrxhArrncaplbrackintlarhkRightTriangleBarrarrlpamacrDiacriticalDoubleAcutenv"
+		"lenumerorightharpoondownboxvrgelaringReGopfQfrlsimeofrHscrfrac18lnapproxrsaquoWedgeboxUrYcircupharpo"
+		"onrightxcupvarsubsetneqdotplushbarrealpartdivideontimesgElTildeFullEqualiiintboxHlessapproxRightUpTe"
+		"eVectornrarrcrppolintcopysrReverseUpEquilibriumgtlParLmidotLscrloarrmldrNegativeMediumSpacezfrnprdis"
+		"inSquareIntersectiontwoheadleftarrowLeftUpDownVectormaprarrbfsrightarrowtailalphabottomEmptyVerySmal"
+		"lSquareltdotmcommanltrisupsubncyDoubleLongLeftArrowoltYacutecularrprbrksldyopfrdshTScyEgravechcyPrec"
+		"edesTildetprimeequalsgsimDownArrowuharrnablaxoplusNotSubsetEqualLeftAngleBracketsubangnsmidovbarrati"
+		"onalsLessEqualGreaterlessdotthickapproxntrianglerightCscrerDotshcydiamsIntersectionmunRightarrowrmou"
+		"stnotninisdDotEqualRightArrowBardopfcemptyvthereforeAcyforksdotBetaNotHumpEqualkappaafHstrokitildeJs"
+		"ercyboxuRvDashrpargtcongShortRightArrowsqcapsNotSquareSubsetpscrdzigrarrhscrisinEquestharrwSupsetthe"
+		"tavcomplexesbulletEtaColoneupharpoonleftzigrarrcurlywedgeifrSuchThatugravelcyangleepsiGreaterEqualag"
+		"ravesuccTopfLstrokzeetrfNotGreaterSlantEqualNotVerticalBarbcongYopfnsucceqOtimesmapstoemptyOacutevar"
+		"proptoprRightDoubleBracketgnapproxsubseteqnsqsupesdoterarrplbbrkfrac45gtrdotiukcyatildeRuleDelayedBu"
+		"mpeqIumlDDkcedilangstsucceqcircledRSfrnvDashtwoheadrightarrowgjcydrcropDifferentialDplankvlsimgLapla"
+		"cetrfangmsdafpreceqHARDcynsupEScyrbrksluNotEqualOcyBarwedRightUpDownVectornshortmiddblacsupplusycycu"
+		"pdotprsimdharrRarrtlRcaronSupplusnrarrwrHarRightTeeArrowscEeqslantgtrjmathmapstoleftabrevesquarfnVda"
+		"shlbrkslddotcompfnsparElementuArrYscrDownRightTeeVectornpreceqsrarrhardcyxotimelobrkbbrktbrknlEEpsil"
+		"onwedgeqcongdotscnapboxhGtzacutenrtrilrarrOtildenearrowngeqslantEmacrleftharpoonupLcedilblacktriangl"
+		"edownkfreogonvellipcsupezwjnsupsetbigoplusDoubleLeftRightArrowVDashcscrcuwedrcedilsubrarrcurarrmtscy"
+		"geslbrvbarocyNestedGreaterGreaterHilbertSpacephonebackcongLeftTeeeqcircScircNotSquareSupersetEqualGr"
+		"eaterLessnVDashiexclvnsupumlnmidsupseteqqcirEglaomegaDownarrowoacuteIJligWfrDownLeftVectorBaremspbig"
+		"capvsupneScaronDownLeftTeeVectorodsoldrtimesNopflgEepsilonMediumSpacegtreqqlessinDoubleRightArrowEfr"
+		"hfrIOcyoscrslarrnotinvaiiotaLeftarrowOverParenthesisblankbsolxdtriLopfeqcolonBcyUmacrtfrNoBreakLeftD"
+		"oubleBracketprofalarrhardboxhddoublebarwedgefallingdotseqmicroupsihnvinfinlesseqgtrvsubneggggammadlE"
+		"VvdashofcirbcyXopfnsimiocylrcornerDZcyHumpDownHumpnvltDcyruluharufrapproxeqUpsicaronprimeRangfrac16b"
+		"revebacksimeqgesdotNotLessTildeaogonNtildedtriflltrianddvsupnEMcyminusbGcircrangleRarrspadesuitsupnE"
+		"rceilbopfDashvlEgfrac13AbreveclubsuitgimelrdquodHarSquareSubsetEqualRopfnesimotimesassccuexfrsolbtim"
+		"espuncspShortLeftArrowemsp13RightArrowLeftArrowbnequivxiominusNotSucceedsTildenexistslsimrhovnlessmh"
+		"olBarrNotGreaterTildegnsimUpEquilibriuminodotRightDownVectorcurvearrowleftrcaronSquareNcaronrisingdo"
+		"tseqrightrightarrowsGreaterGreaterPoincareplanedownharpoonleftcsubboxULlvertneqqamalgcupboxVPrpsifra"
+		"c23frac14DstrokraceDoubleDotNotLeftTriangleBarboxVlRightUpVectorBarnhparbernoupercntlarrtlEcyvcynotn"
+		"ivbprimescacuteboxvldashvBarvsuccnapproxascrLeftUpVectorKopfltriuHarLongrightarrowsmeparslNotSucceed"
+		"sEqualOpenCurlyQuotefrasllbbrkRightTeeldquorvarpiHatveeeqLeftDownTeeVectorprekappavldquocirceqgtccNo"
+		"tSubsetrightarrowSHCHcydzcySubDDotrahdlfishtRightVectornLeftarrowInvisibleCommaNotTildeFullEqualmscr"
+		"MopfcentRightTriangleEqualiiiintsqsubDoubleDownArrowUarrocirdsolUcircCupsubsubsubmultxsqcupsubsetqfr"
+		"bigveeNotLessSlantEqualmpmapstoupsubneImUumlLongleftrightarrowlcaronvangrtForAllwcircqscrcapdotrarrf"
+		"sUcysubEImpliesxodotkscrhomthtbecausENGLeftUpTeeVectorblacktrianglenrArrNegativeVeryThinSpaceETHwrlb"
+		"rkeblacktrianglerightsqsupLongLeftArrowlArrccircnsuphcircLeftTeeArrowdeltauparrowCircleMinusrarrapjf"
+		"rdaggereDotlesgDaggervopflneqqrbraceisinsvaopfiotascedilpluscirdtribsolhsubimpedrxShortUpArrowlongma"
+		"pstoblk14dscrsuphsublesdotoolarrhopfchidfrccupssubdoturcornerrbrackAogonsmtringtrieDiacriticalGraven"
+		"vsimMscrfjliglacutetopplanckhsigmavUnderBracketmidcirWscrUfrswarrowcomptriplusxopfeesqsubseteqLarrle"
+		"ftleftarrowsNotReverseElementcularrpermilparallelProductseArrboxboxYAcyAndfrac38VerticalSeparatorZHc"
+		"ylAtailZcaronequivDDrAtailcircledcircCounterClockwiseContourIntegralProportionalasympnpreangmsdabnir"
+		"arrhknotnivcvBarGdottargetWopfnleqslantapoopfsqsupseteqcapandJcyijligblockrealboxvhsfrNotRightTriang"
+		"leEqualinfintiekopflrharpointintsqcuptimesdcurarrnpartradeiacuteOverBracketogravevertnvgeOEligangmsd"
+		"DownRightVectorBargtrlesscrossnsubpreccurlyeqeuroddaggerGfrnearrKcysqugnapcudarrlltccssmilebigstarst"
+		"arfJukcyrArrzopfbecauserhoInvisibleTimesrmoustacheEopfradiclbrksluraquoeqvparslnharrexpectationZopfs"
+		"scrharrcirffiligGTnotnotinEUpArrowNotGreaterEqualggnvrArrmaleraemptyvlshdlcropcedillenleftarrowccedi"
+		"lCloseCurlyDoubleQuoteafrnumspangmsdaalmoustlozfordmloangFouriertrfUpTeenvgtUnderBardiedbkarowrdcaDi"
+		"amondKscrlparltTstrokthornUpperLeftArrowdowndownarrowsQscrrectIacuterightleftharpoonsAscrntildeoparK"
+		"HcyltcirubreveLtetaNotDoubleVerticalBarCopfiiImacrolcirsollbarrratailutildeTcyDoubleRightTeeboxhuDar"
+		"rgtreqlessalefsymIotaNotNestedGreaterGreaterleftrightarrowsboxURltlarrnotinvbampyscrshortmidlagranrb"
+		"arrDoubleLongRightArrowrlarrvarsupsetneqqrdldharcapcapTcedilNotPrecedesCirclePlusrangvarrjsercywedba"
+		"rlsqbquotlarrfsLeftrightarrowrangdnapidcaretSigmaigravezwnjSqrtOgravefiliglbraceoastsacuteicysubsetn"
+		"eqqGcedilRightarrowspadesfpartintLcaronnprcueEcirccommajcytcedilicircsupEsimrarrRrightarrowbiguplusC"
+		"HcymstposminusgammaHcircxscrlarrTcaronLshEscrbigsqcupColonOumlnsimeqtridotnleftrightarrowstraightphi"
+		"napErightharpoonupRscrnscblk34OopfMapnotnivahamilttrianglescpolintmiddotSquareSupersetCconintvartria"
+		"nglerightYfrcircledSfrac34UdblacScnvlArrsupsetneqqnequivsoftcyIukcyiecyEacuteboxplusEqualTildevfrTfr"
+		"easterbneOslashldcadeggesdototriangledownlowastsimgEboxHdvarsubsetneqqratioJscrwscrhyphennearhknGgan"
+		"grtndashRightDownTeeVectorsmallsetminusorigofacirctwixtnotinbumpeqlrhardrlharultrilooparrowrightmopf"
+		"NusolbarflatintercalUbreveREGumacrordfDownLeftRightVectorSubsetEqualcenterdotncedilgcyIfrfrac58udbla"
+		"cHaceknsucclesccStarurtribsimeTildeTildeltrifsetmnrrarrgeNonBreakingSpaceNotEqualTildesubsetneqdowna"
+		"rrowoperpRacutegneqqDiacriticalTildenaturalsaposSacuteparaltquestalephsuccsimdtdotVerticalBarLowerRi"
+		"ghtArrowfscrrharulbNotDoubleLeftTeemumapdollarfflligbigwedgeoplusboxhDHfrdoteqPsiecyacEkhcyleqRshIog"
+		"onsimechecknpartDiacriticalAcuteApplyFunctionccapslsquoFilledVerySmallSquarensupseteqqQopflozluruhar"
+		"divOscrLeftTriangleEqualsuplarrquaternionsuhblkiscreqslantlessocirSucceedsEqualprnsimphmmatvscrroarr"
+		"escrsubsupboxdLstarUacuteecaronAcircgvnENotExistsoumlwfrcurlyveeuwangleUogongacutezcaronSumimofimacr"
+		"esimcylctyDoubleLongLeftRightArrowsfrowndstrokdigammantrianglelefteqxrarrDotDotXfrrtrieTildeEqualsma"
+		"shpacdprEPfrPhiconintrflooruopfhybullwedgeDscrzdotrarrwboxHDRightTriangletimesbctdotLangXisubplusPcy"
+		"boxvRIcircDoubleContourIntegralPrecedesEqualmnplusZetaintcalapidprecnsimsbquonsqsubecircledastoeligS"
+		"mallCircleegUpTeeArrowuarrboxVLRhoecirenspnsceTildeRcedilBernoullisbnotGbreveNotSupersetpluseitcwint"
+		"lscrnvHarrtstrokprnECapitalDifferentialDIntegralAMPgesdotolnwnearaumlulcornerdfishtDownTeedArrangmsd"
+		"agLessGreaterBecausetrianglerighteqCapawintsmtequesteqvzigzagfrac56nparallellvnEsimdotLeftArrowRight"
+		"Arrowordfrac12CongruentLeftArrowLessSlantEqualWcircpmPrecedesmdashDcaronsmileSHcynsimesectandDopfBre"
+		"vePscrasympeqcirclearrowleftOverBarnpolintgnepoundswarhkcapstrpeziumNotGreaterLesshkswarowupdownarro"
+		"wIscrboxdlperpnaturgtlpargEsuccnsimNotRightTriangleBarLowerLeftArrowEogonnedotlooparrowleftelsdotffl"
+		"igroangMellintrfcfrvarsigmaLeftRightArrowClockwiseContourIntegrallarrlpscnsimNotTildeSucceedsTildesu"
+		"p2succneqqVeryThinSpaceerarrparslpcyandandCOPYurcornsqcapparsimLambdaNotSquareSupersetEcaronNotLessL"
+		"essngephivnparslLongRightArrowlatailprecapproximagpartnlarrVcyutdotxharrangmsdaemlcpcirntlgngeqcomma"
+		"tsupseteqGammadequivgsimeherconandslopegravelesssimExistslnEDfrvarphigtdotAtildeegraveplusacirDiacri"
+		"ticalDotlnsimboxDRiumltrianglerightngsimLeftUpVectorBartrianglelefteqcurrenIopfeumlurcroplanglarrhkF"
+		"opfemptysetsimScedillatesdoteqdotnsubensccueIEcyduharproplhardsuphsolglnwarrowemptyvLJcyNotPrecedesE"
+		"qualleftarrownvapjopfsupmultltimesVertccupssmzetaQUOTboxhUeopflangdlhblknsubEsqsubsetNscrvpropmaltle"
+		"sdotorsupsetiffsubeTRADEapproxdrcornoSgapawconintelcheckmarkVdashyicynLtvOmegaUringwpNegativeThinSpa"
+		"cehArrthkaplarrbfsthetagnEpopfisinvangzarrldrdharharrLeftVectortscrgdotxuplusRBarrsimgGreaterEqualLe"
+		"ssxlArrandvmarkerefrDJcyiopfAacuteLeftTeeVectorleftrightarrownLllfrsextuscrepsivbarwedsimlEnvltrieHo"
+		"rizontalLineblk12neArrTabUopfshortparallelltrParsucccurlyeqcueprhslashNestedLessLessntglncaronellxla"
+		"rrsqsubegescirfnintethyucyelsnapgljNotSucceedsheartsuitloparjscrvartriangleleftrsquolongrightarrowpf"
+		"rEqualupsijukcyTripleDotveesupsetneqvltriheartsangmsdahstraightepsilonucircfrac15rarrodotpitchforksc"
+		"apfltnsJcircLessTildeZeroWidthSpaceleftrightsquigarrowtriangleqyfrolinesubseteqqnbumpecopyswArrUpper"
+		"RightArrowangrtvbdgscrlharulExponentialERightArrowFscreplusscsimLeftTriangleBarLessLessBfrAlphaimagl"
+		"inecirclearrowrightlesgesiprodZdotsearrowbarwedgeCoproductperiodbigcirccurlyeqprecbemptyvprecnapprox"
+		"VerticalLinegfrrealinerthreenrightarrowcurvearrowrightNotTildeTildetdotsmidangmsdacNcedilgtrsimOfrne"
+		"searrnmidprofsurfdemptyvkjcythere4squfnltrieGcyisinKfrscaronRcySucceedsbacksimnbumpvdashlesisindotbf"
+		"rRightTeeVectorbigtriangleupReverseEquilibriumzscrparLongLeftRightArrowboxUlcoprodLeftTriangleSopfva"
+		"rrhoororThickSpacexrArrvArrlambdadcylateDownTeeArrowVbarNotGreaterGreaterlongleftrightarrowCrossrBar"
+		"rUnionPlusgtrapproxprcuebigtriangledownsearhkDownArrowBarPlusMinusffrUgraveubrcyprecneqqNotCupCaplar"
+		"rsimsimeqLcycrarrdwangleacyacybumpbepsinsupseteqxcircVscrAopfgeqgescctriminusnGtvcupbrcapulcroplotim"
+		"esbackprimeupuparrowsecolonqintsimltriangleleftUpArrowDownArrowboxDldalethmcyudarrUpDownArrowrfrnexi"
+		"stcurlyeqsuccrsqbbethsungorvbarveecolonGscrnwArrdcaronefDotLeftRightVectorfcyboxHursquorhellipnaposa"
+		"pEqopfUnderParenthesisFilledSmallSquaresimneDownRightVectorsumNotTildeEqualgeslesAgraveBackslashoint"
+		"SquareSupersetEqualMfrcirethksimtopfmodelsodashCedillacolonelcubmfrzcySupersetorslopesqsupevrtriropl"
+		"usJopfprnaporderofUbrcyPopfedotlaemptyvcapcuprtrifrobrkIcyhorbarYUcytopforkbigcuprightleftarrowsgtra"
+		"rromidicohbaruuarrUarrrtriltriulcornintprodtbrkcupcupracutenjcyNotGreaterFullEqualThereforesearruacu"
+		"teXscrTSHcyordergeqqLongleftarrowThinSpacestrnsveebarohmhalfboxtimesljcyCenterDotfrac78nrarrtopbotls"
+		"quorvarnothingnangscircSOFTcyCloseCurlyQuotetcaronupluscudarrrboxvnshortparallelxutriiinfinCfrboxvHp"
+		"lusmnpartnldrblacklozengetritimedlcornltboxVhnscrplusblessgtrgcircVfrfllignlttelrecupsilonddotseqnle"
+		"succapproxTausupneqprimeleftthreetimesnsupeNotLeftTriangleEquallrtriuogonDownBrevemeasuredanglenlsim"
+		"NotdivonxbetaprapequestngeqqllcornerKappamultimapemacrangsphclubsNewLineboxurYcygneqLeftDownVectorBa"
+		"rHumpEqualNotElementsquareapacirboteacutesigmafOdblacforallvarkappaLessFullEqualpiDelroparrAarregsuf"
+		"ishtboxdRContourIntegralnlArrnsubseteqUparrowecircGreaterFullEqualrarrsimangrtvbexcllgsup1diamondcue"
+		"scforkvsharpbetweenDoubleVerticalBarcapbrcupDoubleLeftArrowsubedotosolbigotimesmacrCircleTimescopfom"
+		"acreDDotTHORNDeltaDotDScynvdasheqsimtopcirRightFloorNotNestedLessLessutrifcirclegplussimhookrightarr"
+		"owbsemisubnErangerbrkeLeftFloorgsimlvarthetallarrNotLeftTriangleLeftArrowBarcsupVdashlMuorarrwreathy"
+		"acuteboxDLloplusprecsimduarrrdquorlurdsharrcyverbarSscrhoarrAumlRoundImpliesdotminusEdotboxvLBscrjci"
+		"rcscyChinGtNotSquareSubsetEqualGreaterTildeleftarrowtailNacutelangleboxHUprecMinusPlusldshSucceedsSl"
+		"antEqualprurelxveesopfAEligegsdotrarrcRightVectorBarcupskcyangmsdadcirscirhairspboxuLCacutesupdsubEm"
+		"ptySmallSquaresigmaCcircVerticalTildeplusdomapstodownangessetmnmidsupsimLleftarrowdscybigodotleqslan"
+		"tnsparLTlozengeboxVHpivcomplementsqsupsetmalteseNotHumpDownHumplowbarPartialDDownLeftVectorscnEsubsi"
+		"mAmacrnvrtrieepartoeavBarvcwconintsetminusexistutriodivBopfltrienwarrtcycircleddashengNotLessGreater"
+		"cuveeZfrdiamondsuitlcedilNJcyLacutexwedgensubseteqqnapproxrharuGJcyplustwoomicronbullhookleftarrowol"
+		"crossLeftCeilingSquareUnionrarrbxnisnacutebkarowLeftDownVectorFcyKJcyYumlItildeNotPrecedesSlantEqual"
+		"otildeUscreparslshchcyZcycdotnumNotSucceedsSlantEqualZacuteodblacCayleyslarrbNotGreaterlopflstrokLef"
+		"tVectorBarnfrEsimbsolbminusdincaregvertneqqrightthreetimesldrusharUnderBraceglESupersetEqualGgSubset"
+		"rtriprodnlesorDoubleUpArrowcaplarrplphiwopfrfishtiquestSquareSubsetrightsquigarrowblacksquarebumpEfn"
+		"ofhstrokimagetintbowtieacutenLtnisUpArrowBarfemalenotinvcncongleqqshyConintlthreelongleftarrowVopfNo"
+		"tLessEqualintddarrNotCongruentotimesOrntrianglerighteqtaulHarfrac25lneqCupCapVeefopfngttrisbvarepsil"
+		"ondharlShortDownArrowboxdrrscrRightAngleBracketquatintiogontildeleftharpoondownsstarflesseqqgtrboxVr"
+		"KcedilycircOmacrddIdotrealsthicksimnLeftrightarrowUniondrbkarowszligRightUpVectornaturaldashRfrkgree"
+		"nncupImaginaryImidastLfrllhardsupCircleDotuharlimathseswargbreveRightCeilingGreaterSlantEqualscsmtes"
+		"lesdotcoloneqNcyinfinmDDotplanckrcubYIcyaeligNegativeThickSpacediamOcircrarrtlregCcedildivideOmicron"
+		"sdotbdownharpoonrightlathksearowelinterssimplusbsimnrtriexmapplusdungEexponentialeproflinesupsupboxm"
+		"inus"
+		;
+	const char VALUES[] =
+		"\xe2\x85\x97\xe2\x97\x82\xe2\x84\xa4\xe2\x80\x89\xe2\x8e\xb0\xe2\x8c\xa2\xe2\x95\xa0\xe2\x86\x99"
+		"\xe2\x8b\x98\xe2\x80\x8f\xe2\x89\xb0\xe2\xab\x91\xc2\xa5\xd0\xb0\xe2\xa8\xb5\xc5\x80\xe2\x8a\x87"
+		"\xc3\xbc\xcb\x9b\xf0\x9d\x94\x8d\xe2\x95\x93\xe2\x87\x8c\xe2\xab\x84\xe2\x89\x94\xe2\x89\x90\xe2"
+		"\x8a\xa1\xc3\xb8\xd0\xb6\xe2\xa9\x86\xe2\x94\x98\x3b\xe2\x80\xb1\xe2\xa9\xad\xcc\xb8\xe2\xa4\xa3"
+		"\x2a\xc5\xa8\xe2\x80\x85\xc4\x8c\xe2\x8b\xab\xe2\x84\x98\xe2\x80\xb9\xce\xa5\xe2\x89\x8a\xe2\x86"
+		"\x93\xe2\xa9\xbe\xcc\xb8\xc3\x8b\xe2\x89\xa0\xe2\x8b\x82\xe2\xa8\xb1\xe2\x8a\x94\xef\xb8\x80\xd1"
+		"\x92\xe2\x89\xaf\xd1\x9b\xc2\xab\xe2\x86\xb1\xe2\xa8\xaa\xe2\x87\x8e\xf0\x9d\x94\x89\xe2\xa5\xae"
+		"\xf0\x9d\x94\x91\xe2\xab\xaf\xe2\x86\xbc\xe2\x8a\x8b\xef\xb8\x80\xe2\x8c\x88\xe2\xa9\x85\xe2\x80"
+		"\x8e\xe2\x9d\xb3\xe2\x8a\x80\xe2\x87\x95\xe2\x89\xa6\xcc\xb8\xe2\x80\xb3\xc3\xa1\xce\x93\xe2\xa7"
+		"\x81\xf0\x9d\x92\xb5\xe2\x8f\x9e\xe2\x89\x8f\xe2\xa9\xbc\xe2\xaa\xbe\xd1\x83\xe2\x89\xae\xe2\x80"
+		"\xb5\xe2\x80\x9e\xf0\x9d\x94\x84\xc4\x8a\xe2\x8a\x82\xe2\x83\x92\xc4\x8d\xe2\xaa\x85\xe2\xa9\xba"
+		"\xe2\x8a\x89\xe2\x84\x8d\xe2\xaa\x87\xe2\xa4\xaa\xce\xbd\xe2\x8b\xb5\xcc\xb8\xe2\x89\xaa\xc5\xaf"
+		"\xc3\x8c\xe2\x80\x9c\xe2\xaa\xb0\xe2\xaa\x89\xf0\x9d\x92\xb7\xe2\x8a\x82\xe2\x83\x92\xe2\x8c\x8a"
+		"\xc2\xb3\xe2\x8b\xb4\x20\xe2\x87\xb5\xe2\x88\xac\xe2\x87\x8b\xce\x98\xc3\xbf\xe2\x88\xb7\xe2\x88"
+		"\x8b\xc3\xb4\xe2\x80\x96\xf0\x9d\x95\x9f\x29\xe2\x88\x8b\xf0\x9d\x95\xa3\xc3\x85\xe2\xab\x8b\xef"
+		"\xb8\x80\xe2\xa5\x95\xe2\x89\xbc\xe2\xa9\xbe\xf0\x9d\x95\x98\xf0\x9d\x92\xaf\xcf\x91\xe2\x8b\xaa"
+		"\xcf\xb6\xe2\x87\x95\xe2\xa4\xa9\xce\xa0\xe2\x88\x9d\xe2\x87\x9a\xe2\x9f\xba\xe2\xa9\x83\x5b\xe2"
+		"\xa8\x97\xe2\xa7\x90\xe2\x86\xac\xc4\x81\xcb\x9d\xe2\x89\xa4\xe2\x83\x92\xe2\x84\x96\xe2\x87\x81"
+		"\xe2\x94\x9c\xe2\x8b\x9b\xc3\xa5\xe2\x84\x9c\xf0\x9d\x94\xbe\xf0\x9d\x94\x94\xe2\xaa\x8d\xf0\x9d"
+		"\x94\xac\xe2\x84\x8b\xe2\x85\x9b\xe2\xaa\x89\xe2\x80\xba\xe2\x8b\x80\xe2\x95\x99\xc5\xb6\xe2\x86"
+		"\xbe\xe2\x8b\x83\xe2\x8a\x8a\xef\xb8\x80\xe2\x88\x94\xe2\x84\x8f\xe2\x84\x9c\xe2\x8b\x87\xe2\xaa"
+		"\x8c\xe2\x89\x85\xe2\x88\xad\xe2\x95\x90\xe2\xaa\x85\xe2\xa5\x9c\xe2\xa4\xb3\xcc\xb8\xe2\xa8\x92"
+		"\xe2\x84\x97\xe2\xa5\xaf\xe2\xa6\x95\xc4\xbf\xe2\x84\x92\xe2\x87\xbd\xe2\x80\xa6\xe2\x80\x8b\xf0"
+		"\x9d\x94\xb7\xe2\x8a\x80\xe2\x8b\xb2\xe2\x8a\x93\xe2\x86\x9e\xe2\xa5\x91\xe2\x86\xa6\xe2\xa4\xa0"
+		"\xe2\x86\xa3\xce\xb1\xe2\x8a\xa5\xe2\x96\xab\xe2\x8b\x96\xe2\xa8\xa9\xe2\x8b\xaa\xe2\xab\x94\xd0"
+		"\xbd\xe2\x9f\xb8\xe2\xa7\x80\xc3\x9d\xe2\xa4\xbd\xe2\xa6\x8e\xf0\x9d\x95\xaa\xe2\x86\xb3\xd0\xa6"
+		"\xc3\x88\xd1\x87\xe2\x89\xbe\xe2\x80\xb4\x3d\xe2\x89\xb3\xe2\x86\x93\xe2\x86\xbe\xe2\x88\x87\xe2"
+		"\xa8\x81\xe2\x8a\x88\xe2\x9f\xa8\xe2\x8a\x82\xe2\x88\xa0\xe2\x88\xa4\xe2\x8c\xbd\xe2\x84\x9a\xe2"
+		"\x8b\x9a\xe2\x8b\x96\xe2\x89\x88\xe2\x8b\xab\xf0\x9d\x92\x9e\xe2\x89\x93\xd1\x88\xe2\x99\xa6\xe2"
+		"\x8b\x82\xce\xbc\xe2\x87\x8f\xe2\x8e\xb1\xe2\x88\x8c\xe2\x8b\xba\xe2\x89\x90\xe2\x87\xa5\xf0\x9d"
+		"\x95\x95\xe2\xa6\xb2\xe2\x88\xb4\xd0\x90\xe2\x8b\x94\xe2\x8b\x85\xce\x92\xe2\x89\x8f\xcc\xb8\xce"
+		"\xba\xe2\x81\xa1\xc4\xa6\xc4\xa9\xd0\x88\xe2\x95\x98\xe2\x8a\xa8\xe2\xa6\x94\xe2\x89\x85\xe2\x86"
+		"\x92\xe2\x8a\x93\xef\xb8\x80\xe2\x8a\x8f\xcc\xb8\xf0\x9d\x93\x85\xe2\x9f\xbf\xf0\x9d\x92\xbd\xe2"
+		"\x8b\xb9\x3f\xe2\x86\xad\xe2\x8b\x91\xcf\x91\xe2\x84\x82\xe2\x80\xa2\xce\x97\xe2\xa9\xb4\xe2\x86"
+		"\xbf\xe2\x87\x9d\xe2\x8b\x8f\xf0\x9d\x94\xa6\xe2\x88\x8b\xc3\xb9\xd0\xbb\xe2\x88\xa0\xce\xb5\xe2"
+		"\x89\xa5\xc3\xa0\xe2\x89\xbb\xf0\x9d\x95\x8b\xc5\x81\xe2\x84\xa8\xe2\xa9\xbe\xcc\xb8\xe2\x88\xa4"
+		"\xe2\x89\x8c\xf0\x9d\x95\x90\xe2\xaa\xb0\xcc\xb8\xe2\xa8\xb7\xe2\x86\xa6\xe2\x88\x85\xc3\x93\xe2"
+		"\x88\x9d\xe2\x89\xba\xe2\x9f\xa7\xe2\xaa\x8a\xe2\x8a\x86\xe2\x8b\xa3\xe2\xa9\xa6\xe2\xa5\x85\xe2"
+		"\x8e\xb5\xe2\x85\x98\xe2\x8b\x97\xd1\x96\xc3\xa3\xe2\xa7\xb4\xe2\x89\x8e\xc3\x8f\xe2\x85\x85\xc4"
+		"\xb7\xc3\x85\xe2\xaa\xb0\xc2\xae\xf0\x9d\x94\x96\xe2\x8a\xad\xe2\x86\xa0\xd1\x93\xe2\x8c\x8c\xe2"
+		"\x85\x86\xe2\x84\x8f\xe2\xaa\x8f\xe2\x84\x92\xe2\xa6\xad\xe2\xaa\xaf\xd0\xaa\xe2\xab\x86\xcc\xb8"
+		"\xd0\xa1\xe2\xa6\x90\xe2\x89\xa0\xd0\x9e\xe2\x8c\x86\xe2\xa5\x8f\xe2\x88\xa4\xcb\x9d\xe2\xab\x80"
+		"\xd1\x8b\xe2\x8a\x8d\xe2\x89\xbe\xe2\x87\x82\xe2\xa4\x96\xc5\x98\xe2\x8b\x91\x2b\xe2\x86\x9d\xcc"
+		"\xb8\xe2\xa5\xa4\xe2\x86\xa6\xe2\xaa\xb4\xe2\xaa\x96\xc8\xb7\xe2\x86\xa4\xc4\x83\xe2\x96\xaa\xe2"
+		"\x8a\xae\xe2\xa6\x8f\xcb\x99\xe2\x88\x98\xe2\x88\xa5\xe2\x88\x88\xe2\x87\x91\xf0\x9d\x92\xb4\xe2"
+		"\xa5\x9f\xe2\xaa\xaf\xcc\xb8\xe2\x86\x92\xd1\x8a\xe2\xa8\x82\xe2\x9f\xa6\xe2\x8e\xb6\xe2\x89\xa6"
+		"\xcc\xb8\xce\x95\xe2\x89\x99\xe2\xa9\xad\xe2\xaa\xba\xe2\x94\x80\xe2\x89\xab\xc5\xba\xe2\x8b\xab"
+		"\xe2\x87\x86\xc3\x95\xe2\x86\x97\xe2\xa9\xbe\xcc\xb8\xc4\x92\xe2\x86\xbc\xc4\xbb\xe2\x96\xbe\xf0"
+		"\x9d\x94\xa8\xc4\x99\xe2\x8b\xae\xe2\xab\x92\xe2\x80\x8d\xe2\x8a\x83\xe2\x83\x92\xe2\xa8\x81\xe2"
+		"\x87\x94\xe2\x8a\xab\xf0\x9d\x92\xb8\xe2\x8b\x8f\xc5\x97\xe2\xa5\xb9\xe2\xa4\xbc\xd1\x86\xe2\x8b"
+		"\x9b\xef\xb8\x80\xc2\xa6\xd0\xbe\xe2\x89\xab\xe2\x84\x8b\xe2\x98\x8e\xe2\x89\x8c\xe2\x8a\xa3\xe2"
+		"\x89\x96\xc5\x9c\xe2\x8b\xa3\xe2\x89\xb7\xe2\x8a\xaf\xc2\xa1\xe2\x8a\x83\xe2\x83\x92\xc2\xa8\xe2"
+		"\x88\xa4\xe2\xab\x86\xe2\xa7\x83\xe2\xaa\xa5\xcf\x89\xe2\x87\x93\xc3\xb3\xc4\xb2\xf0\x9d\x94\x9a"
+		"\xe2\xa5\x96\xe2\x80\x83\xe2\x8b\x82\xe2\x8a\x8b\xef\xb8\x80\xc5\xa0\xe2\xa5\x9e\xe2\xa6\xbc\xe2"
+		"\x8b\x8a\xe2\x84\x95\xe2\xaa\x91\xce\xb5\xe2\x81\x9f\xe2\xaa\x8c\xe2\x88\x88\xe2\x87\x92\xf0\x9d"
+		"\x94\x88\xf0\x9d\x94\xa5\xd0\x81\xe2\x84\xb4\xe2\x86\x90\xe2\x88\x89\xe2\x84\xa9\xe2\x87\x90\xe2"
+		"\x8f\x9c\xe2\x90\xa3\x5c\xe2\x96\xbd\xf0\x9d\x95\x83\xe2\x89\x95\xd0\x91\xc5\xaa\xf0\x9d\x94\xb1"
+		"\xe2\x81\xa0\xe2\x9f\xa6\xe2\x8c\xae\xe2\x87\x81\xe2\x94\xac\xe2\x8c\x86\xe2\x89\x92\xc2\xb5\xcf"
+		"\x92\xe2\xa7\x9e\xe2\x8b\x9a\xe2\x8a\x8a\xef\xb8\x80\xe2\x8b\x99\xcf\x9d\xe2\x89\xa6\xe2\x8a\xaa"
+		"\xe2\xa6\xbf\xd0\xb1\xf0\x9d\x95\x8f\xe2\x89\x81\xd1\x91\xe2\x8c\x9f\xd0\x8f\xe2\x89\x8e\x3c\xe2"
+		"\x83\x92\xd0\x94\xe2\xa5\xa8\xf0\x9d\x94\xb2\xe2\x89\x8a\xcf\x92\xcb\x87\xe2\x80\xb2\xe2\x9f\xab"
+		"\xe2\x85\x99\xcb\x98\xe2\x8b\x8d\xe2\xaa\x80\xe2\x89\xb4\xc4\x85\xc3\x91\xe2\x96\xbe\xe2\x97\xba"
+		"\xe2\xa9\x9c\xe2\xab\x8c\xef\xb8\x80\xd0\x9c\xe2\x8a\x9f\xc4\x9c\xe2\x9f\xa9\xe2\x86\xa0\xe2\x99"
+		"\xa0\xe2\xab\x8c\xe2\x8c\x89\xf0\x9d\x95\x93\xe2\xab\xa4\xe2\xaa\x8b\xe2\x85\x93\xc4\x82\xe2\x99"
+		"\xa3\xe2\x84\xb7\xe2\x80\x9d\xe2\xa5\xa5\xe2\x8a\x91\xe2\x84\x9d\xe2\x89\x82\xcc\xb8\xe2\xa8\xb6"
+		"\xe2\x89\xbd\xf0\x9d\x94\xb5\xe2\xa7\x84\xc3\x97\xe2\x80\x88\xe2\x86\x90\xe2\x80\x84\xe2\x87\x84"
+		"\xe2\x89\xa1\xe2\x83\xa5\xce\xbe\xe2\x8a\x96\xe2\x89\xbf\xcc\xb8\xe2\x88\x84\xe2\x89\xb2\xcf\xb1"
+		"\xe2\x89\xae\xe2\x84\xa7\xe2\xa4\x8e\xe2\x89\xb5\xe2\x8b\xa7\xe2\xa5\xae\xc4\xb1\xe2\x87\x82\xe2"
+		"\x86\xb6\xc5\x99\xe2\x96\xa1\xc5\x87\xe2\x89\x93\xe2\x87\x89\xe2\xaa\xa2\xe2\x84\x8c\xe2\x87\x83"
+		"\xe2\xab\x8f\xe2\x95\x9d\xe2\x89\xa8\xef\xb8\x80\xe2\xa8\xbf\xe2\x88\xaa\xe2\x95\x91\xe2\xaa\xbb"
+		"\xcf\x88\xe2\x85\x94\xc2\xbc\xc4\x90\xe2\x88\xbd\xcc\xb1\xc2\xa8\xe2\xa7\x8f\xcc\xb8\xe2\x95\xa2"
+		"\xe2\xa5\x94\xe2\xab\xb2\xe2\x84\xac\x25\xe2\x86\xa2\xd0\xad\xd0\xb2\xe2\x8b\xbe\xe2\x84\x99\xc4"
+		"\x87\xe2\x94\xa4\xe2\x8a\xa3\xe2\xab\xa7\xe2\xaa\xba\xf0\x9d\x92\xb6\xe2\x86\xbf\xf0\x9d\x95\x82"
+		"\xe2\x97\x83\xe2\xa5\xa3\xe2\x9f\xb9\xe2\xa7\xa4\xe2\xaa\xb0\xcc\xb8\xe2\x80\x98\xe2\x81\x84\xe2"
+		"\x9d\xb2\xe2\x8a\xa2\xe2\x80\x9e\xcf\x96\x5e\xe2\x89\x9a\xe2\xa5\xa1\xe2\xaa\xaf\xcf\xb0\xe2\x80"
+		"\x9c\xe2\x89\x97\xe2\xaa\xa7\xe2\x8a\x82\xe2\x83\x92\xe2\x86\x92\xd0\xa9\xd1\x9f\xe2\x8b\x90\xe2"
+		"\xa4\x91\xe2\xa5\xbc\xe2\x87\x80\xe2\x87\x8d\xe2\x81\xa3\xe2\x89\x87\xf0\x9d\x93\x82\xf0\x9d\x95"
+		"\x84\xc2\xa2\xe2\x8a\xb5\xe2\xa8\x8c\xe2\x8a\x8f\xe2\x87\x93\xe2\xa5\x89\xe2\xa7\xb6\xc3\x9b\xe2"
+		"\x8b\x93\xe2\xab\x95\xe2\xab\x81\xe2\xa8\x86\xe2\x8a\x82\xf0\x9d\x94\xae\xe2\x8b\x81\xe2\xa9\xbd"
+		"\xcc\xb8\xe2\x88\x93\xe2\x86\xa5\xe2\x8a\x8a\xe2\x84\x91\xc3\x9c\xe2\x9f\xba\xc4\xbe\xe2\xa6\x9c"
+		"\xe2\x88\x80\xc5\xb5\xf0\x9d\x93\x86\xe2\xa9\x80\xe2\xa4\x9e\xd0\xa3\xe2\xab\x85\xe2\x87\x92\xe2"
+		"\xa8\x80\xf0\x9d\x93\x80\xe2\x88\xbb\xe2\x88\xb5\xc5\x8a\xe2\xa5\xa0\xe2\x96\xb4\xe2\x87\x8f\xe2"
+		"\x80\x8b\xc3\x90\xe2\x89\x80\xe2\xa6\x8b\xe2\x96\xb8\xe2\x8a\x90\xe2\x9f\xb5\xe2\x87\x90\xc4\x89"
+		"\xe2\x8a\x85\xc4\xa5\xe2\x86\xa4\xce\xb4\xe2\x86\x91\xe2\x8a\x96\xe2\xa5\xb5\xf0\x9d\x94\xa7\xe2"
+		"\x80\xa0\xe2\x89\x91\xe2\x8b\x9a\xef\xb8\x80\xe2\x80\xa1\xf0\x9d\x95\xa7\xe2\x89\xa8\x7d\xe2\x8b"
+		"\xb3\xf0\x9d\x95\x92\xce\xb9\xc5\x9f\xe2\xa8\xa2\xe2\x96\xbf\xe2\x9f\x88\xc6\xb5\xe2\x84\x9e\xe2"
+		"\x86\x91\xe2\x9f\xbc\xe2\x96\x91\xf0\x9d\x92\xb9\xe2\xab\x97\xe2\xaa\x81\xe2\x86\xba\xf0\x9d\x95"
+		"\x99\xcf\x87\xf0\x9d\x94\xa1\xe2\xa9\x8c\xe2\xaa\xbd\xe2\x8c\x9d\x5d\xc4\x84\xe2\xaa\xaa\xcb\x9a"
+		"\xe2\x89\x9c\x60\xe2\x88\xbc\xe2\x83\x92\xe2\x84\xb3\x66\x6a\xc4\xba\xe2\x8a\xa4\xe2\x84\x8e\xcf"
+		"\x82\xe2\x8e\xb5\xe2\xab\xb0\xf0\x9d\x92\xb2\xf0\x9d\x94\x98\xe2\x86\x99\xe2\x88\x81\xe2\xa8\xb9"
+		"\xf0\x9d\x95\xa9\xe2\x85\x87\xe2\x8a\x91\xe2\x86\x9e\xe2\x87\x87\xe2\x88\x8c\xe2\x86\xb6\xe2\x80"
+		"\xb0\xe2\x88\xa5\xe2\x88\x8f\xe2\x87\x98\xe2\xa7\x89\xd0\xaf\xe2\xa9\x93\xe2\x85\x9c\xe2\x9d\x98"
+		"\xd0\x96\xe2\xa4\x9b\xc5\xbd\xe2\xa9\xb8\xe2\xa4\x9c\xe2\x8a\x9a\xe2\x88\xb3\xe2\x88\x9d\xe2\x89"
+		"\x88\xe2\xaa\xaf\xcc\xb8\xe2\xa6\xa9\xe2\x88\x8b\xe2\x86\xaa\xe2\x8b\xbd\xe2\xab\xa8\xc4\xa0\xe2"
+		"\x8c\x96\xf0\x9d\x95\x8e\xe2\xa9\xbd\xcc\xb8\xe2\x89\x88\xf0\x9d\x95\xa0\xe2\x8a\x92\xe2\xa9\x84"
+		"\xd0\x99\xc4\xb3\xe2\x96\x88\xe2\x84\x9c\xe2\x94\xbc\xf0\x9d\x94\xb0\xe2\x8b\xad\xe2\xa7\x9d\xf0"
+		"\x9d\x95\x9c\xe2\x87\x8b\xe2\xa8\x95\xe2\x8a\x94\xe2\xa8\xb0\xe2\x86\xb7\xe2\x88\xa6\xe2\x84\xa2"
+		"\xc3\xad\xe2\x8e\xb4\xc3\xb2\x7c\xe2\x89\xa5\xe2\x83\x92\xc5\x92\xe2\x88\xa1\xe2\xa5\x97\xe2\x89"
+		"\xb7\xe2\x9c\x97\xe2\x8a\x84\xe2\x89\xbc\xe2\x82\xac\xe2\x80\xa1\xf0\x9d\x94\x8a\xe2\x86\x97\xd0"
+		"\x9a\xe2\x96\xa1\xe2\xaa\x8a\xe2\xa4\xb8\xe2\xaa\xa6\xe2\x8c\xa3\xe2\x98\x85\xe2\x98\x85\xd0\x84"
+		"\xe2\x87\x92\xf0\x9d\x95\xab\xe2\x88\xb5\xcf\x81\xe2\x81\xa2\xe2\x8e\xb1\xf0\x9d\x94\xbc\xe2\x88"
+		"\x9a\xe2\xa6\x8d\xc2\xbb\xe2\xa7\xa5\xe2\x86\xae\xe2\x84\xb0\xe2\x84\xa4\xf0\x9d\x93\x88\xe2\xa5"
+		"\x88\xef\xac\x83\x3e\xc2\xac\xe2\x8b\xb9\xcc\xb8\xe2\x86\x91\xe2\x89\xb1\xe2\x89\xab\xe2\xa4\x83"
+		"\xe2\x99\x82\xe2\xa6\xb3\xe2\x86\xb0\xe2\x8c\x8d\xc2\xb8\xe2\x89\xa4\xe2\x86\x9a\xc3\xa7\xe2\x80"
+		"\x9d\xf0\x9d\x94\x9e\xe2\x80\x87\xe2\xa6\xa8\xe2\x8e\xb0\xe2\xa7\xab\xc2\xba\xe2\x9f\xac\xe2\x84"
+		"\xb1\xe2\x8a\xa5\x3e\xe2\x83\x92\x5f\xc2\xa8\xe2\xa4\x8f\xe2\xa4\xb7\xe2\x8b\x84\xf0\x9d\x92\xa6"
+		"\xe2\xa6\x93\xc5\xa6\xc3\xbe\xe2\x86\x96\xe2\x87\x8a\xf0\x9d\x92\xac\xe2\x96\xad\xc3\x8d\xe2\x87"
+		"\x8c\xf0\x9d\x92\x9c\xc3\xb1\xe2\xa6\xb7\xd0\xa5\xe2\xa9\xb9\xc5\xad\xe2\x89\xaa\xce\xb7\xe2\x88"
+		"\xa6\xe2\x84\x82\xe2\x85\x88\xc4\xaa\xe2\xa6\xbe\x2f\xe2\xa4\x8c\xe2\xa4\x9a\xc5\xa9\xd0\xa2\xe2"
+		"\x8a\xa8\xe2\x94\xb4\xe2\x86\xa1\xe2\x8b\x9b\xe2\x84\xb5\xce\x99\xe2\xaa\xa2\xcc\xb8\xe2\x87\x86"
+		"\xe2\x95\x9a\xe2\xa5\xb6\xe2\x8b\xb7\x26\xf0\x9d\x93\x8e\xe2\x88\xa3\xe2\x84\x92\xe2\xa4\x8d\xe2"
+		"\x9f\xb9\xe2\x87\x84\xe2\xab\x8c\xef\xb8\x80\xe2\xa5\xa9\xe2\xa9\x8b\xc5\xa2\xe2\x8a\x80\xe2\x8a"
+		"\x95\xe2\x9f\xa9\xe2\x86\x95\xd1\x98\xe2\xa9\x9f\x5b\x22\xe2\xa4\x9d\xe2\x87\x94\xe2\xa6\x92\xe2"
+		"\x89\x8b\xcc\xb8\xe2\x81\x81\xce\xa3\xc3\xac\xe2\x80\x8c\xe2\x88\x9a\xc3\x92\xef\xac\x81\x7b\xe2"
+		"\x8a\x9b\xc5\x9b\xd0\xb8\xe2\xab\x8b\xc4\xa2\xe2\x87\x92\xe2\x99\xa0\xe2\xa8\x8d\xc4\xbd\xe2\x8b"
+		"\xa0\xc3\x8a\x2c\xd0\xb9\xc5\xa3\xc3\xae\xe2\xab\x86\xe2\xa5\xb2\xe2\x87\x9b\xe2\xa8\x84\xd0\xa7"
+		"\xe2\x88\xbe\xe2\x88\x92\xce\xb3\xc4\xa4\xf0\x9d\x93\x8d\xe2\x86\x90\xc5\xa4\xe2\x86\xb0\xe2\x84"
+		"\xb0\xe2\xa8\x86\xe2\x88\xb7\xc3\x96\xe2\x89\x84\xe2\x97\xac\xe2\x86\xae\xcf\x95\xe2\xa9\xb0\xcc"
+		"\xb8\xe2\x87\x80\xe2\x84\x9b\xe2\x8a\x81\xe2\x96\x93\xf0\x9d\x95\x86\xe2\xa4\x85\xe2\x88\x8c\xe2"
+		"\x84\x8b\xe2\x96\xb5\xe2\xa8\x93\xc2\xb7\xe2\x8a\x90\xe2\x88\xb0\xe2\x8a\xb3\xf0\x9d\x94\x9c\xe2"
+		"\x93\x88\xc2\xbe\xc5\xb0\xe2\xaa\xbc\xe2\xa4\x82\xe2\xab\x8c\xe2\x89\xa2\xd1\x8c\xd0\x86\xd0\xb5"
+		"\xc3\x89\xe2\x8a\x9e\xe2\x89\x82\xf0\x9d\x94\xb3\xf0\x9d\x94\x97\xe2\xa9\xae\x3d\xe2\x83\xa5\xc3"
+		"\x98\xe2\xa4\xb6\xc2\xb0\xe2\xaa\x82\xe2\x96\xbf\xe2\x88\x97\xe2\xaa\xa0\xe2\x95\xa4\xe2\xab\x8b"
+		"\xef\xb8\x80\xe2\x88\xb6\xf0\x9d\x92\xa5\xf0\x9d\x93\x8c\xe2\x80\x90\xe2\xa4\xa4\xe2\x8b\x99\xcc"
+		"\xb8\xe2\x88\x9f\xe2\x80\x93\xe2\xa5\x9d\xe2\x88\x96\xe2\x8a\xb6\xc3\xa2\xe2\x89\xac\xe2\x88\x89"
+		"\xe2\x89\x8f\xe2\xa5\xad\xe2\x87\x8c\xe2\x97\xb8\xe2\x86\xac\xf0\x9d\x95\x9e\xce\x9d\xe2\x8c\xbf"
+		"\xe2\x99\xad\xe2\x8a\xba\xc5\xac\xc2\xae\xc5\xab\xc2\xaa\xe2\xa5\x90\xe2\x8a\x86\xc2\xb7\xc5\x86"
+		"\xd0\xb3\xe2\x84\x91\xe2\x85\x9d\xc5\xb1\xcb\x87\xe2\x8a\x81\xe2\xaa\xa8\xe2\x8b\x86\xe2\x97\xb9"
+		"\xe2\x8b\x8d\xe2\x89\x88\xe2\x97\x82\xe2\x88\x96\xe2\x87\x89\xe2\x89\xa5\xc2\xa0\xe2\x89\x82\xcc"
+		"\xb8\xe2\x8a\x8a\xe2\x86\x93\xe2\xa6\xb9\xc5\x94\xe2\x89\xa9\xcb\x9c\xe2\x84\x95\x27\xc5\x9a\xc2"
+		"\xb6\xe2\xa9\xbb\xe2\x84\xb5\xe2\x89\xbf\xe2\x8b\xb1\xe2\x88\xa3\xe2\x86\x98\xf0\x9d\x92\xbb\xe2"
+		"\xa5\xac\xe2\xab\xad\xe2\xab\xa4\xe2\x8a\xb8\x24\xef\xac\x84\xe2\x8b\x80\xe2\x8a\x95\xe2\x95\xa5"
+		"\xe2\x84\x8c\xe2\x89\x90\xce\xa8\xd1\x8d\xe2\x88\xbe\xcc\xb3\xd1\x85\xe2\x89\xa4\xe2\x86\xb1\xc4"
+		"\xae\xe2\x89\x83\xe2\x9c\x93\xe2\x88\x82\xcc\xb8\xc2\xb4\xe2\x81\xa1\xe2\xa9\x8d\xe2\x80\x98\xe2"
+		"\x96\xaa\xe2\xab\x86\xcc\xb8\xe2\x84\x9a\xe2\x97\x8a\xe2\xa5\xa6\xc3\xb7\xf0\x9d\x92\xaa\xe2\x8a"
+		"\xb4\xe2\xa5\xbb\xe2\x84\x8d\xe2\x96\x80\xf0\x9d\x92\xbe\xe2\xaa\x95\xe2\x8a\x9a\xe2\xaa\xb0\xe2"
+		"\x8b\xa8\xe2\x84\xb3\xf0\x9d\x93\x8b\xe2\x87\xbe\xe2\x84\xaf\xe2\xab\x93\xe2\x95\x95\xe2\x98\x86"
+		"\xc3\x9a\xc4\x9b\xc3\x82\xe2\x89\xa9\xef\xb8\x80\xe2\x88\x84\xc3\xb6\xf0\x9d\x94\xb4\xe2\x8b\x8e"
+		"\xe2\xa6\xa7\xc5\xb2\xc7\xb5\xc5\xbe\xe2\x88\x91\xe2\x8a\xb7\xc4\xab\xe2\x89\x82\xe2\x8c\xad\xe2"
+		"\x9f\xba\xe2\x8c\xa2\xc4\x91\xcf\x9d\xe2\x8b\xac\xe2\x9f\xb6\xe2\x83\x9c\xf0\x9d\x94\x9b\xe2\x8a"
+		"\xb5\xe2\x89\x83\xe2\xa8\xb3\xe2\x88\xbf\xe2\xaa\xb3\xf0\x9d\x94\x93\xce\xa6\xe2\x88\xae\xe2\x8c"
+		"\x8b\xf0\x9d\x95\xa6\xe2\x81\x83\xe2\x88\xa7\xf0\x9d\x92\x9f\xc5\xbc\xe2\x86\x9d\xe2\x95\xa6\xe2"
+		"\x8a\xb3\xe2\x8a\xa0\xe2\x8b\xaf\xe2\x9f\xaa\xce\x9e\xe2\xaa\xbf\xd0\x9f\xe2\x95\x9e\xc3\x8e\xe2"
+		"\x88\xaf\xe2\xaa\xaf\xe2\x88\x93\xce\x96\xe2\x8a\xba\xe2\x89\x8b\xe2\x8b\xa8\xe2\x80\x9a\xe2\x8b"
+		"\xa2\xe2\x8a\x9b\xc5\x93\xe2\x88\x98\xe2\xaa\x9a\xe2\x86\xa5\xe2\x86\x91\xe2\x95\xa3\xce\xa1\xe2"
+		"\x89\x96\xe2\x80\x82\xe2\xaa\xb0\xcc\xb8\xe2\x88\xbc\xc5\x96\xe2\x84\xac\xe2\x8c\x90\xc4\x9e\xe2"
+		"\x8a\x83\xe2\x83\x92\xe2\xa9\xb2\xe2\x81\xa2\xe2\x88\xb1\xf0\x9d\x93\x81\xe2\xa4\x84\xc5\xa7\xe2"
+		"\xaa\xb5\xe2\x85\x85\xe2\x88\xab\x26\xe2\xaa\x84\xe2\xa4\xa7\xc3\xa4\xe2\x8c\x9c\xe2\xa5\xbf\xe2"
+		"\x8a\xa4\xe2\x87\x93\xe2\xa6\xae\xe2\x89\xb6\xe2\x88\xb5\xe2\x8a\xb5\xe2\x8b\x92\xe2\xa8\x91\xe2"
+		"\xaa\xac\xe2\x89\x9f\xe2\xa6\x9a\xe2\x85\x9a\xe2\x88\xa6\xe2\x89\xa8\xef\xb8\x80\xe2\xa9\xaa\xe2"
+		"\x87\x86\xe2\xa9\x9d\xc2\xbd\xe2\x89\xa1\xe2\x86\x90\xe2\xa9\xbd\xc5\xb4\xc2\xb1\xe2\x89\xba\xe2"
+		"\x80\x94\xc4\x8e\xe2\x8c\xa3\xd0\xa8\xe2\x89\x84\xc2\xa7\xe2\x88\xa7\xf0\x9d\x94\xbb\xcb\x98\xf0"
+		"\x9d\x92\xab\xe2\x89\x8d\xe2\x86\xba\xe2\x80\xbe\xe2\xa8\x94\xe2\xaa\x88\xc2\xa3\xe2\xa4\xa6\xe2"
+		"\x88\xa9\xef\xb8\x80\xe2\x8f\xa2\xe2\x89\xb9\xe2\xa4\xa6\xe2\x86\x95\xe2\x84\x90\xe2\x94\x90\xe2"
+		"\x8a\xa5\xe2\x99\xae\x3e\x28\xe2\x89\xa7\xe2\x8b\xa9\xe2\xa7\x90\xcc\xb8\xe2\x86\x99\xc4\x98\xe2"
+		"\x89\x90\xcc\xb8\xe2\x86\xab\xe2\xaa\x97\xef\xac\x80\xe2\x9f\xad\xe2\x84\xb3\xf0\x9d\x94\xa0\xcf"
+		"\x82\xe2\x86\x94\xe2\x88\xb2\xe2\x86\xab\xe2\x8b\xa9\xe2\x89\x81\xe2\x89\xbf\xc2\xb2\xe2\xaa\xb6"
+		"\xe2\x80\x8a\xe2\xa5\xb1\xe2\xab\xbd\xd0\xbf\xe2\xa9\x95\xc2\xa9\xe2\x8c\x9d\xe2\x8a\x93\xe2\xab"
+		"\xb3\xce\x9b\xe2\x8a\x90\xcc\xb8\xc4\x9a\xe2\x89\xaa\xcc\xb8\xe2\x89\xb1\xcf\x95\xe2\xab\xbd\xe2"
+		"\x83\xa5\xe2\x9f\xb6\xe2\xa4\x99\xe2\xaa\xb7\xe2\x84\x91\xe2\x86\x9a\xd0\x92\xe2\x8b\xb0\xe2\x9f"
+		"\xb7\xe2\xa6\xac\xe2\xab\x9b\xe2\x97\x8b\xe2\x89\xb8\xe2\x89\xb1\x40\xe2\x8a\x87\xcf\x9c\xe2\x89"
+		"\xa1\xe2\xaa\x8e\xe2\x8a\xb9\xe2\xa9\x98\x60\xe2\x89\xb2\xe2\x88\x83\xe2\x89\xa8\xf0\x9d\x94\x87"
+		"\xcf\x95\xe2\x8b\x97\xc3\x83\xc3\xa8\xe2\xa8\xa3\xcb\x99\xe2\x8b\xa6\xe2\x95\x94\xc3\xaf\xe2\x96"
+		"\xb9\xe2\x89\xb5\xe2\xa5\x98\xe2\x8a\xb4\xc2\xa4\xf0\x9d\x95\x80\xc3\xab\xe2\x8c\x8e\xe2\x9f\xa8"
+		"\xe2\x86\xa9\xf0\x9d\x94\xbd\xe2\x88\x85\xe2\x88\xbc\xc5\x9e\xe2\xaa\xad\xef\xb8\x80\xe2\x89\x91"
+		"\xe2\x8a\x88\xe2\x8b\xa1\xd0\x95\xe2\xa5\xaf\xe2\x88\x9d\xe2\x86\xbd\xe2\x9f\x89\xe2\x89\xb7\xe2"
+		"\x86\x96\xe2\x88\x85\xd0\x89\xe2\xaa\xaf\xcc\xb8\xe2\x86\x90\xe2\x89\x8d\xe2\x83\x92\xf0\x9d\x95"
+		"\x9b\xe2\xab\x82\xe2\x8b\x89\xe2\x80\x96\xe2\xa9\x90\xce\xb6\x22\xe2\x95\xa8\xf0\x9d\x95\x96\xe2"
+		"\xa6\x91\xe2\x96\x84\xe2\xab\x85\xcc\xb8\xe2\x8a\x8f\xf0\x9d\x92\xa9\xe2\x88\x9d\xe2\x9c\xa0\xe2"
+		"\xaa\x83\xe2\x8a\x83\xe2\x87\x94\xe2\x8a\x86\xe2\x84\xa2\xe2\x89\x88\xe2\x8c\x9f\xe2\x93\x88\xe2"
+		"\xaa\x86\xe2\x88\xb3\xe2\xaa\x99\xe2\x9c\x93\xe2\x8a\xa9\xd1\x97\xe2\x89\xaa\xcc\xb8\xce\xa9\xc5"
+		"\xae\xe2\x84\x98\xe2\x80\x8b\xe2\x87\x94\xe2\x89\x88\xe2\xa4\x9f\xce\xb8\xe2\x89\xa9\xf0\x9d\x95"
+		"\xa1\xe2\x88\x88\xe2\x8d\xbc\xe2\xa5\xa7\xe2\x86\x94\xe2\x86\xbc\xf0\x9d\x93\x89\xc4\xa1\xe2\xa8"
+		"\x84\xe2\xa4\x90\xe2\xaa\x9e\xe2\x8b\x9b\xe2\x9f\xb8\xe2\xa9\x9a\xe2\x96\xae\xf0\x9d\x94\xa2\xd0"
+		"\x82\xf0\x9d\x95\x9a\xc3\x81\xe2\xa5\x9a\xe2\x86\x94\xe2\x8b\x98\xcc\xb8\xf0\x9d\x94\xa9\xe2\x9c"
+		"\xb6\xf0\x9d\x93\x8a\xcf\xb5\xe2\x8c\x85\xe2\xaa\x9f\xe2\x8a\xb4\xe2\x83\x92\xe2\x94\x80\xe2\x96"
+		"\x92\xe2\x87\x97\x09\xf0\x9d\x95\x8c\xe2\x88\xa5\xe2\xa6\x96\xe2\x89\xbd\xe2\x8b\x9e\xe2\x84\x8f"
+		"\xe2\x89\xaa\xe2\x89\xb9\xc5\x88\xe2\x84\x93\xe2\x9f\xb5\xe2\x8a\x91\xe2\xa9\xbe\xe2\xa8\x90\xc3"
+		"\xb0\xd1\x8e\xe2\xaa\x95\xe2\x89\x89\xe2\xaa\xa4\xe2\x8a\x81\xe2\x99\xa5\xe2\xa6\x85\xf0\x9d\x92"
+		"\xbf\xe2\x8a\xb2\xe2\x80\x99\xe2\x9f\xb6\xf0\x9d\x94\xad\xe2\xa9\xb5\xcf\x85\xd1\x94\xe2\x83\x9b"
+		"\xe2\x88\xa8\xe2\x8a\x8b\xe2\x8a\xb2\xe2\x99\xa5\xe2\xa6\xaf\xcf\xb5\xc3\xbb\xe2\x85\x95\xe2\x86"
+		"\x92\xe2\x8a\x99\xe2\x8b\x94\xe2\xaa\xb8\xe2\x96\xb1\xc4\xb4\xe2\x89\xb2\xe2\x80\x8b\xe2\x86\xad"
+		"\xe2\x89\x9c\xf0\x9d\x94\xb6\xe2\x80\xbe\xe2\xab\x85\xe2\x89\x8f\xcc\xb8\xc2\xa9\xe2\x87\x99\xe2"
+		"\x86\x97\xe2\xa6\x9d\xe2\x84\x8a\xe2\xa5\xaa\xe2\x85\x87\xe2\x86\x92\xe2\x84\xb1\xe2\xa9\xb1\xe2"
+		"\x89\xbf\xe2\xa7\x8f\xe2\xaa\xa1\xf0\x9d\x94\x85\xce\x91\xe2\x84\x90\xe2\x86\xbb\xe2\xaa\x93\xe2"
+		"\xa8\xbc\xc5\xbb\xe2\x86\x98\xe2\x8c\x85\xe2\x88\x90\x2e\xe2\x97\xaf\xe2\x8b\x9e\xe2\xa6\xb0\xe2"
+		"\xaa\xb9\x7c\xf0\x9d\x94\xa4\xe2\x84\x9b\xe2\x8b\x8c\xe2\x86\x9b\xe2\x86\xb7\xe2\x89\x89\xe2\x83"
+		"\x9b\xe2\x88\xa3\xe2\xa6\xaa\xc5\x85\xe2\x89\xb3\xf0\x9d\x94\x92\xe2\xa4\xa8\xe2\xab\xae\xe2\x8c"
+		"\x93\xe2\xa6\xb1\xd1\x9c\xe2\x88\xb4\xe2\x96\xaa\xe2\x8b\xac\xd0\x93\xe2\x88\x88\xf0\x9d\x94\x8e"
+		"\xc5\xa1\xd0\xa0\xe2\x89\xbb\xe2\x88\xbd\xe2\x89\x8e\xcc\xb8\xe2\x8a\xa2\xe2\xa9\xbd\xe2\x8b\xb5"
+		"\xf0\x9d\x94\x9f\xe2\xa5\x9b\xe2\x96\xb3\xe2\x87\x8b\xf0\x9d\x93\x8f\xe2\x88\xa5\xe2\x9f\xb7\xe2"
+		"\x95\x9c\xe2\x88\x90\xe2\x8a\xb2\xf0\x9d\x95\x8a\xcf\xb1\xe2\xa9\x96\xe2\x81\x9f\xe2\x80\x8a\xe2"
+		"\x9f\xb9\xe2\x87\x95\xce\xbb\xd0\xb4\xe2\xaa\xad\xe2\x86\xa7\xe2\xab\xab\xe2\x89\xab\xcc\xb8\xe2"
+		"\x9f\xb7\xe2\xa8\xaf\xe2\xa4\x8f\xe2\x8a\x8e\xe2\xaa\x86\xe2\x89\xbc\xe2\x96\xbd\xe2\xa4\xa5\xe2"
+		"\xa4\x93\xc2\xb1\xf0\x9d\x94\xa3\xc3\x99\xd1\x9e\xe2\xaa\xb5\xe2\x89\xad\xe2\xa5\xb3\xe2\x89\x83"
+		"\xd0\x9b\xe2\x86\xb5\xe2\xa6\xa6\xe2\x88\xbe\xd1\x8f\xe2\x89\x8e\xcf\xb6\xe2\x8a\x89\xe2\x97\xaf"
+		"\xf0\x9d\x92\xb1\xf0\x9d\x94\xb8\xe2\x89\xa5\xe2\xaa\xa9\xe2\xa8\xba\xe2\x89\xab\xcc\xb8\xe2\xa9"
+		"\x88\xe2\x8c\x8f\xe2\xa8\xb4\xe2\x80\xb5\xe2\x87\x88\xe2\x89\x95\xe2\xa8\x8c\xe2\xaa\x9d\xe2\x97"
+		"\x83\xe2\x87\x85\xe2\x95\x96\xe2\x84\xb8\xd0\xbc\xe2\x87\x85\xe2\x86\x95\xf0\x9d\x94\xaf\xe2\x88"
+		"\x84\xe2\x8b\x9f\x5d\xe2\x84\xb6\xe2\x99\xaa\xe2\xa9\x9b\xe2\x8a\xbd\x3a\xf0\x9d\x92\xa2\xe2\x87"
+		"\x96\xc4\x8f\xe2\x89\x92\xe2\xa5\x8e\xd1\x84\xe2\x95\xa7\xe2\x80\x99\xe2\x80\xa6\xc5\x89\xe2\xa9"
+		"\xb0\xf0\x9d\x95\xa2\xe2\x8f\x9d\xe2\x97\xbc\xe2\x89\x86\xe2\x87\x81\xe2\x88\x91\xe2\x89\x84\xe2"
+		"\xaa\x94\xc3\x80\xe2\x88\x96\xe2\x88\xae\xe2\x8a\x92\xf0\x9d\x94\x90\xe2\x89\x97\xe2\x88\xbc\xf0"
+		"\x9d\x95\xa5\xe2\x8a\xa7\xe2\x8a\x9d\xc2\xb8\xe2\x89\x94\x7b\xf0\x9d\x94\xaa\xd0\xb7\xe2\x8a\x83"
+		"\xe2\xa9\x97\xe2\x8a\x92\xe2\x8a\xb3\xe2\xa8\xae\xf0\x9d\x95\x81\xe2\xaa\xb9\xe2\x84\xb4\xd0\x8e"
+		"\xe2\x84\x99\xc4\x97\xe2\xa6\xb4\xe2\xa9\x87\xe2\x96\xb8\xe2\x9f\xa7\xd0\x98\xe2\x80\x95\xd0\xae"
+		"\xe2\xab\x9a\xe2\x8b\x83\xe2\x87\x84\xe2\xa5\xb8\xe2\xa6\xb6\xe2\x81\xa3\xe2\xa6\xb5\xe2\x87\x88"
+		"\xe2\x86\x9f\xe2\xa7\x8e\xe2\x8c\x9c\xe2\xa8\xbc\xe2\x8e\xb4\xe2\xa9\x8a\xc5\x95\xd1\x9a\xe2\x89"
+		"\xa7\xcc\xb8\xe2\x88\xb4\xe2\x86\x98\xc3\xba\xf0\x9d\x92\xb3\xd0\x8b\xe2\x84\xb4\xe2\x89\xa7\xe2"
+		"\x9f\xb8\xe2\x80\x89\xc2\xaf\xe2\x8a\xbb\xce\xa9\xc2\xbd\xe2\x8a\xa0\xd1\x99\xc2\xb7\xe2\x85\x9e"
+		"\xe2\x86\x9b\xe2\x8c\xb6\xe2\x80\x9a\xe2\x88\x85\xe2\x88\xa0\xe2\x83\x92\xc5\x9d\xd0\xac\xe2\x80"
+		"\x99\xc5\xa5\xe2\x8a\x8e\xe2\xa4\xb5\xe2\x94\x82\xe2\x88\xa6\xe2\x96\xb3\xe2\xa7\x9c\xe2\x84\xad"
+		"\xe2\x95\xaa\xc2\xb1\xe2\x88\x82\xe2\x80\xa5\xe2\xa7\xab\xe2\xa8\xbb\xe2\x8c\x9e\x3c\xe2\x95\xab"
+		"\xf0\x9d\x93\x83\xe2\x8a\x9e\xe2\x89\xb6\xc4\x9d\xf0\x9d\x94\x99\xef\xac\x82\xe2\x89\xae\xe2\x8c"
+		"\x95\xcf\x85\xe2\xa9\xb7\xe2\x89\xb0\xe2\xaa\xb8\xce\xa4\xe2\x8a\x8b\xe2\x81\x97\xe2\x8b\x8b\xe2"
+		"\x8a\x89\xe2\x8b\xac\xe2\x8a\xbf\xc5\xb3\xcc\x91\xe2\x88\xa1\xe2\x89\xb4\xe2\xab\xac\xe2\x8b\x87"
+		"\xce\xb2\xe2\xaa\xb7\xe2\x89\x9f\xe2\x89\xa7\xcc\xb8\xe2\x8c\x9e\xce\x9a\xe2\x8a\xb8\xc4\x93\xe2"
+		"\x88\xa2\xe2\x99\xa3\x0a\xe2\x94\x94\xd0\xab\xe2\xaa\x88\xe2\xa5\x99\xe2\x89\x8f\xe2\x88\x89\xe2"
+		"\x96\xa1\xe2\xa9\xaf\xe2\x8a\xa5\xc3\xa9\xcf\x82\xc5\x90\xe2\x88\x80\xcf\xb0\xe2\x89\xa6\xcf\x80"
+		"\xe2\x88\x87\xe2\xa6\x86\xe2\x87\x9b\xe2\xaa\x96\xe2\xa5\xbe\xe2\x95\x92\xe2\x88\xae\xe2\x87\x8d"
+		"\xe2\x8a\x88\xe2\x87\x91\xc3\xaa\xe2\x89\xa7\xe2\xa5\xb4\xe2\x8a\xbe\x21\xe2\x89\xb6\xc2\xb9\xe2"
+		"\x8b\x84\xe2\x8b\x9f\xe2\xab\x99\xe2\x99\xaf\xe2\x89\xac\xe2\x88\xa5\xe2\xa9\x89\xe2\x87\x90\xe2"
+		"\xab\x83\xe2\x8a\x98\xe2\xa8\x82\xc2\xaf\xe2\x8a\x97\xf0\x9d\x95\x94\xc5\x8d\xe2\xa9\xb7\xc3\x9e"
+		"\xce\x94\xc2\xa8\xd0\x85\xe2\x8a\xac\xe2\x89\x82\xe2\xab\xb1\xe2\x8c\x8b\xe2\xaa\xa1\xcc\xb8\xe2"
+		"\x96\xb4\xcb\x86\xe2\x8b\x9a\xe2\xa8\xa6\xe2\x86\xaa\xe2\x81\x8f\xe2\xab\x8b\xe2\xa6\xa5\xe2\xa6"
+		"\x8c\xe2\x8c\x8a\xe2\xaa\x90\xcf\x91\xe2\x87\x87\xe2\x8b\xaa\xe2\x87\xa4\xe2\xab\x90\xe2\xab\xa6"
+		"\xce\x9c\xe2\x86\xbb\xe2\x89\x80\xc3\xbd\xe2\x95\x97\xe2\xa8\xad\xe2\x89\xbe\xe2\x87\xb5\xe2\x80"
+		"\x9d\xe2\xa5\x8a\xd1\x80\x7c\xf0\x9d\x92\xae\xe2\x87\xbf\xc3\x84\xe2\xa5\xb0\xe2\x88\xb8\xc4\x96"
+		"\xe2\x95\xa1\xe2\x84\xac\xc4\xb5\xd1\x81\xce\xa7\xe2\x89\xab\xe2\x83\x92\xe2\x8b\xa2\xe2\x89\xb3"
+		"\xe2\x86\xa2\xc5\x83\xe2\x9f\xa8\xe2\x95\xa9\xe2\x89\xba\xe2\x88\x93\xe2\x86\xb2\xe2\x89\xbd\xe2"
+		"\x8a\xb0\xe2\x8b\x81\xf0\x9d\x95\xa4\xc3\x86\xe2\xaa\x98\xe2\xa4\xb3\xe2\xa5\x93\xe2\x88\xaa\xef"
+		"\xb8\x80\xd0\xba\xe2\xa6\xab\xe2\xa7\x82\xe2\x80\x8a\xe2\x95\x9b\xc4\x86\xe2\xab\x98\xe2\x97\xbb"
+		"\xcf\x83\xc4\x88\xe2\x89\x80\xe2\x88\x94\xe2\x86\xa7\xe2\xa6\xa4\xe2\x88\x96\xe2\x88\xa3\xe2\xab"
+		"\x88\xe2\x87\x9a\xd1\x95\xe2\xa8\x80\xe2\xa9\xbd\xe2\x88\xa6\x3c\xe2\x97\x8a\xe2\x95\xac\xcf\x96"
+		"\xe2\x88\x81\xe2\x8a\x90\xe2\x9c\xa0\xe2\x89\x8e\xcc\xb8\x5f\xe2\x88\x82\xe2\x86\xbd\xe2\xaa\xb6"
+		"\xe2\xab\x87\xc4\x80\xe2\x8a\xb5\xe2\x83\x92\xe2\x8b\x95\xe2\xa4\xa8\xe2\xab\xa9\xe2\x88\xb2\xe2"
+		"\x88\x96\xe2\x88\x83\xe2\x96\xb5\xe2\xa8\xb8\xf0\x9d\x94\xb9\xe2\x8a\xb4\xe2\x86\x96\xd1\x82\xe2"
+		"\x8a\x9d\xc5\x8b\xe2\x89\xb8\xe2\x8b\x8e\xe2\x84\xa8\xe2\x99\xa6\xc4\xbc\xd0\x8a\xc4\xb9\xe2\x8b"
+		"\x80\xe2\xab\x85\xcc\xb8\xe2\x89\x89\xe2\x87\x80\xd0\x83\xe2\xa8\xa7\xce\xbf\xe2\x80\xa2\xe2\x86"
+		"\xa9\xe2\xa6\xbb\xe2\x8c\x88\xe2\x8a\x94\xe2\x87\xa5\xe2\x8b\xbb\xc5\x84\xe2\xa4\x8d\xe2\x87\x83"
+		"\xd0\xa4\xd0\x8c\xc5\xb8\xc4\xa8\xe2\x8b\xa0\xc3\xb5\xf0\x9d\x92\xb0\xe2\xa7\xa3\xd1\x89\xd0\x97"
+		"\xc4\x8b\x23\xe2\x8b\xa1\xc5\xb9\xc5\x91\xe2\x84\xad\xe2\x87\xa4\xe2\x89\xaf\xf0\x9d\x95\x9d\xc5"
+		"\x82\xe2\xa5\x92\xf0\x9d\x94\xab\xe2\xa9\xb3\xe2\xa7\x85\xe2\x88\xb8\xe2\x84\x85\xe2\x89\xa9\xef"
+		"\xb8\x80\xe2\x8b\x8c\xe2\xa5\x8b\xe2\x8f\x9f\xe2\xaa\x92\xe2\x8a\x87\xe2\x8b\x99\xe2\x8b\x90\xe2"
+		"\x96\xb9\xe2\x88\x8f\xe2\xa9\xbd\xcc\xb8\xe2\x88\xa8\xe2\x87\x91\xe2\x88\xa9\xe2\xa4\xb9\xcf\x86"
+		"\xf0\x9d\x95\xa8\xe2\xa5\xbd\xc2\xbf\xe2\x8a\x8f\xe2\x86\x9d\xe2\x96\xaa\xe2\xaa\xae\xc6\x92\xc4"
+		"\xa7\xe2\x84\x91\xe2\x88\xad\xe2\x8b\x88\xc2\xb4\xe2\x89\xaa\xe2\x83\x92\xe2\x8b\xbc\xe2\xa4\x92"
+		"\xe2\x99\x80\xe2\x8b\xb6\xe2\x89\x87\xe2\x89\xa6\xc2\xad\xe2\x88\xaf\xe2\x8b\x8b\xe2\x9f\xb5\xf0"
+		"\x9d\x95\x8d\xe2\x89\xb0\xe2\x88\xab\xe2\x87\x8a\xe2\x89\xa2\xe2\x8a\x97\xe2\xa9\x94\xe2\x8b\xad"
+		"\xcf\x84\xe2\xa5\xa2\xe2\x85\x96\xe2\xaa\x87\xe2\x89\x8d\xe2\x8b\x81\xf0\x9d\x95\x97\xe2\x89\xaf"
+		"\xe2\xa7\x8d\xcf\xb5\xe2\x87\x83\xe2\x86\x93\xe2\x94\x8c\xf0\x9d\x93\x87\xe2\x9f\xa9\xe2\xa8\x96"
+		"\xc4\xaf\xcb\x9c\xe2\x86\xbd\xe2\x8b\x86\xe2\xaa\x8b\xe2\x95\x9f\xc4\xb6\xc5\xb7\xc5\x8c\xe2\x85"
+		"\x86\xc4\xb0\xe2\x84\x9d\xe2\x88\xbc\xe2\x87\x8e\xe2\x8b\x83\xe2\xa4\x90\xc3\x9f\xe2\x86\xbe\xe2"
+		"\x99\xae\xe2\x80\x90\xe2\x84\x9c\xc4\xb8\xe2\xa9\x82\xe2\x85\x88\x2a\xf0\x9d\x94\x8f\xe2\xa5\xab"
+		"\xe2\x8a\x83\xe2\x8a\x99\xe2\x86\xbf\xc4\xb1\xe2\xa4\xa9\xc4\x9f\xe2\x8c\x89\xe2\xa9\xbe\xe2\x89"
+		"\xbb\xe2\xaa\xac\xef\xb8\x80\xe2\xa9\xbf\xe2\x89\x94\xd0\x9d\xe2\x88\x9e\xe2\x88\xba\xe2\x84\x8f"
+		"\x7d\xd0\x87\xc3\xa6\xe2\x80\x8b\xe2\x8b\x84\xc3\x94\xe2\x86\xa3\xc2\xae\xc3\x87\xc3\xb7\xce\x9f"
+		"\xe2\x8a\xa1\xe2\x87\x82\xe2\xaa\xab\xe2\xa4\xa5\xe2\x8f\xa7\xe2\xa8\xa4\xe2\x88\xbd\xe2\x8b\xad"
+		"\xe2\x9f\xbc\xe2\xa8\xa5\xe2\x89\xa7\xcc\xb8\xe2\x85\x87\xe2\x8c\x92\xe2\xab\x96\xe2\x8a\x9f"
+		;
+	struct Entry {
+		uint16_t name_offset;
+		uint8_t name_size;
+		uint8_t legacy; // Also recognized without the semicolon.
+		uint16_t value_offset;
+		uint16_t value_size;
+	};
+	// Indexed by slots of the perfect hash.
+	const Entry ENTRIES[REFERENCE_COUNT] = {
+		{0, 6, 0, 0, 3}, {6, 17, 0, 3, 3}, {23, 8, 0, 6, 3}, {31, 6, 0, 9, 3},
+		{37, 10, 0, 12, 3}, {47, 5, 0, 15, 3}, {52, 5, 0, 18, 3}, {57, 5, 0, 21, 3},
+		{62, 2, 0, 24, 3}, {64, 3, 0, 27, 3}, {67, 4, 0, 30, 3}, {71, 5, 0, 33, 3},
+		{76, 3, 1, 36, 2}, {79, 3, 0, 38, 2}, {82, 7, 0, 40, 3}, {89, 6, 0, 43, 2},
+		{95, 4, 0, 45, 3}, {99, 4, 1, 48, 2}, {103, 4, 0, 50, 2}, {107, 3, 0, 52, 4},
+		{110, 5, 0, 56, 3}, {115, 11, 0, 59, 3}, {126, 7, 0, 62, 3}, {133, 6, 0, 65, 3},
+		{139, 5, 0, 68, 3}, {144, 9, 0, 71, 3}, {153, 6, 1, 74, 2}, {159, 4, 0, 76, 2},
+		{163, 6, 0, 78, 3}, {169, 5, 0, 81, 3}, {174, 4, 0, 84, 1}, {178, 7, 0, 85, 3},
+		{185, 8, 0, 88, 5}, {193, 6, 0, 93, 3}, {199, 3, 0, 96, 1}, {202, 6, 0, 97, 2},
+		{208, 6, 0, 99, 3}, {214, 6, 0, 102, 2}, {220, 16, 0, 104, 3}, {236, 6, 0, 107, 3},
+		{242, 6, 0, 110, 3}, {248, 7, 0, 113, 2}, {255, 3, 0, 115, 3}, {258, 4, 0, 118, 3},
+		{262, 4, 0, 121, 5}, {266, 4, 1, 126, 2}, {270, 2, 0, 128, 3}, {272, 4, 0, 131, 3},
+		{276, 8, 0, 134, 3}, {284, 6, 0, 137, 6}, {290, 4, 0, 143, 2}, {294, 4, 0, 145, 3},
+		{298, 5, 0, 148, 2}, {303, 5, 1, 150, 2}, {308, 3, 0, 152, 3}, {311, 7, 0, 155, 3},
+		{318, 5, 0, 158, 3}, {323, 3, 0, 161, 4}, {326, 5, 0, 165, 3}, {331, 3, 0, 168, 4},
+		{334, 6, 0, 172, 3}, {340, 5, 0, 175, 3}, {345, 12, 0, 178, 6}, {357, 5, 0, 184, 3},
+		{362, 5, 0, 187, 3}, {367, 3, 0, 190, 3}, {370, 5, 0, 193, 3}, {375, 5, 0, 196, 3},
+		{380, 11, 0, 199, 3}, {391, 5, 0, 202, 5}, {396, 5, 0, 207, 3}, {401, 6, 1, 210, 2},
+		{407, 5, 0, 212, 2}, {412, 3, 0, 214, 3}, {415, 4, 0, 217, 4}, {419, 9, 0, 221, 3},
+		{428, 5, 0, 224, 3}, {433, 7, 0, 227, 3}, {440, 6, 0, 230, 3}, {446, 3, 0, 233, 2},
+		{449, 7, 0, 235, 3}, {456, 6, 0, 238, 3}, {462, 5, 0, 241, 3}, {467, 3, 0, 244, 4},
+		{470, 4, 0, 248, 2}, {474, 5, 0, 250, 6}, {479, 6, 0, 256, 2}, {485, 3, 0, 258, 3},
+		{488, 5, 0, 261, 3}, {493, 16, 0, 264, 3}, {509, 4, 0, 267, 3}, {513, 3, 0, 270, 3},
+		{516, 6, 0, 273, 3}, {522, 2, 0, 276, 2}, {524, 8, 0, 278, 5}, {532, 2, 0, 283, 3},
+		{534, 5, 0, 286, 2}, {539, 6, 1, 288, 2}, {545, 20, 0, 290, 3}, {565, 3, 0, 293, 3},
+		{568, 4, 0, 296, 3}, {572, 4, 0, 299, 4}, {576, 7, 0, 303, 6}, {583, 6, 0, 309, 3},
+		{589, 4, 1, 312, 2}, {593, 5, 0, 314, 3}, {598, 4, 1, 317, 1}, {602, 16, 0, 318, 3},
+		{618, 3, 0, 321, 3}, {621, 17, 0, 324, 3}, {638, 5, 0, 327, 2}, {643, 4, 1, 329, 2},
+		{647, 10, 0, 331, 3}, {657, 14, 0, 334, 3}, {671, 5, 1, 337, 2}, {676, 6, 0, 339, 3},
+		{682, 4, 0, 342, 4}, {686, 4, 0, 346, 1}, {690, 3, 0, 347, 3}, {693, 4, 0, 350, 4},
+		{697, 5, 1, 354, 2}, {702, 6, 0, 356, 6}, {708, 18, 0, 362, 3}, {726, 18, 0, 365, 3},
+		{744, 8, 0, 368, 3}, {752, 4, 0, 371, 4}, {756, 4, 0, 375, 4}, {760, 8, 0, 379, 2},
+		{768, 13, 0, 381, 3}, {781, 11, 0, 384, 2}, {792, 17, 0, 386, 3}, {809, 4, 0, 389, 3},
+		{813, 2, 0, 392, 2}, {815, 6, 0, 394, 3}, {821, 5, 0, 397, 3}, {826, 5, 0, 400, 3},
+		{831, 4, 0, 403, 3}, {835, 6, 0, 406, 1}, {841, 8, 0, 407, 3}, {849, 16, 0, 410, 3},
+		{865, 6, 0, 413, 3}, {871, 5, 0, 416, 2}, {876, 22, 0, 418, 2}, {898, 4, 0, 420, 6},
+		{902, 6, 0, 426, 3}, {908, 16, 0, 429, 3}, {924, 5, 0, 432, 3}, {929, 3, 0, 435, 3},
+		{932, 5, 1, 438, 2}, {937, 2, 0, 440, 3}, {939, 4, 0, 443, 4}, {943, 3, 0, 447, 4},
+		{946, 5, 0, 451, 3}, {951, 3, 0, 454, 4}, {954, 4, 0, 458, 3}, {958, 6, 0, 461, 3},
+		{964, 8, 0, 464, 3}, {972, 6, 0, 467, 3}, {978, 5, 0, 470, 3}, {983, 5, 0, 473, 3},
+		{988, 5, 0, 476, 2}, {993, 14, 0, 478, 3}, {1007, 4, 0, 481, 3}, {1011, 12, 0, 484, 6},
+		{1023, 7, 0, 490, 3}, {1030, 4, 0, 493, 3}, {1034, 8, 0, 496, 3}, {1042, 13, 0, 499, 3},
+		{1055, 3, 0, 502, 3}, {1058, 14, 0, 505, 3}, {1072, 5, 0, 508, 3}, {1077, 4, 0, 511, 3},
+		{1081, 10, 0, 514, 3}, {1091, 16, 0, 517, 3}, {1107, 6, 0, 520, 5}, {1113, 8, 0, 525, 3},
+		{1121, 6, 0, 528, 3}, {1127, 20, 0, 531, 3}, {1147, 6, 0, 534, 3}, {1153, 6, 0, 537, 2},
+		{1159, 4, 0, 539, 3}, {1163, 5, 0, 542, 3}, {1168, 4, 0, 545, 3}, {1172, 19, 0, 548, 3},
+		{1191, 3, 0, 551, 4}, {1194, 3, 0, 555, 3}, {1197, 5, 0, 558, 3}, {1202, 18, 0, 561, 3},
+		{1220, 16, 0, 564, 3}, {1236, 16, 0, 567, 3}, {1252, 3, 0, 570, 3}, {1255, 7, 0, 573, 3},
+		{1262, 14, 0, 576, 3}, {1276, 5, 0, 579, 2}, {1281, 6, 0, 581, 3}, {1287, 20, 0, 584, 3},
+		{1307, 5, 0, 587, 3}, {1312, 6, 0, 590, 3}, {1318, 5, 0, 593, 3}, {1323, 6, 0, 596, 3},
+		{1329, 3, 0, 599, 2}, {1332, 19, 0, 601, 3}, {1351, 3, 0, 604, 3}, {1354, 6, 1, 607, 2},
+		{1360, 7, 0, 609, 3}, {1367, 7, 0, 612, 3}, {1374, 4, 0, 615, 4}, {1378, 4, 0, 619, 3},
+		{1382, 4, 0, 622, 2}, {1386, 6, 1, 624, 2}, {1392, 4, 0, 626, 2}, {1396, 13, 0, 628, 3},
+		{1409, 6, 0, 631, 3}, {1415, 6, 0, 634, 1}, {1421, 4, 0, 635, 3}, {1425, 9, 0, 638, 3},
+		{1434, 5, 0, 641, 3}, {1439, 5, 0, 644, 3}, {1444, 6, 0, 647, 3}, {1450, 14, 0, 650, 3},
+		{1464, 16, 0, 653, 3}, {1480, 3, 0, 656, 3}, {1483, 3, 0, 659, 3}, {1486, 5, 0, 662, 3},
+		{1491, 5, 0, 665, 3}, {1496, 9, 0, 668, 3}, {1505, 16, 0, 671, 3}, {1521, 7, 0, 674, 3},
+		{1528, 11, 0, 677, 3}, {1539, 14, 0, 680, 3}, {1553, 4, 0, 683, 4}, {1557, 5, 0, 687, 3},
+		{1562, 4, 0, 690, 2}, {1566, 5, 0, 692, 3}, {1571, 12, 0, 695, 3}, {1583, 2, 0, 698, 2},
+		{1585, 11, 0, 700, 3}, {1596, 6, 0, 703, 3}, {1602, 5, 0, 706, 3}, {1607, 4, 0, 709, 3},
+		{1611, 8, 0, 712, 3}, {1619, 13, 0, 715, 3}, {1632, 4, 0, 718, 4}, {1636, 7, 0, 722, 3},
+		{1643, 9, 0, 725, 3}, {1652, 3, 0, 728, 2}, {1655, 4, 0, 730, 3}, {1659, 4, 0, 733, 3},
+		{1663, 4, 0, 736, 2}, {1667, 12, 0, 738, 5}, {1679, 5, 0, 743, 2}, {1684, 2, 0, 745, 3},
+		{1686, 6, 0, 748, 2}, {1692, 6, 0, 750, 2}, {1698, 6, 0, 752, 2}, {1704, 5, 0, 754, 3},
+		{1709, 5, 0, 757, 3}, {1714, 6, 0, 760, 3}, {1720, 4, 0, 763, 3}, {1724, 15, 0, 766, 3},
+		{1739, 6, 0, 769, 6}, {1745, 15, 0, 775, 5}, {1760, 4, 0, 780, 4}, {1764, 8, 0, 784, 3},
+		{1772, 4, 0, 787, 4}, {1776, 5, 0, 791, 3}, {1781, 5, 0, 794, 1}, {1786, 5, 0, 795, 3},
+		{1791, 6, 0, 798, 3}, {1797, 6, 0, 801, 2}, {1803, 9, 0, 803, 3}, {1812, 6, 0, 806, 3},
+		{1818, 3, 0, 809, 2}, {1821, 6, 0, 811, 3}, {1827, 13, 0, 814, 3}, {1840, 7, 0, 817, 3},
+		{1847, 10, 0, 820, 3}, {1857, 3, 0, 823, 4}, {1860, 8, 0, 827, 3}, {1868, 6, 1, 830, 2},
+		{1874, 3, 0, 832, 2}, {1877, 5, 0, 834, 3}, {1882, 4, 0, 837, 2}, {1886, 12, 0, 839, 3},
+		{1898, 6, 1, 842, 2}, {1904, 4, 0, 844, 3}, {1908, 4, 0, 847, 4}, {1912, 6, 0, 851, 2},
+		{1918, 6, 0, 853, 3}, {1924, 20, 0, 856, 5}, {1944, 14, 0, 861, 3}, {1958, 5, 0, 864, 3},
+		{1963, 4, 0, 867, 4}, {1967, 7, 0, 871, 5}, {1974, 6, 0, 876, 3}, {1980, 6, 0, 879, 3},
+		{1986, 5, 0, 882, 3}, {1991, 6, 1, 885, 2}, {1997, 9, 0, 887, 3}, {2006, 2, 0, 890, 3},
+		{2008, 18, 0, 893, 3}, {2026, 8, 0, 896, 3}, {2034, 8, 0, 899, 3}, {2042, 7, 0, 902, 3},
+		{2049, 5, 0, 905, 3}, {2054, 6, 0, 908, 3}, {2060, 4, 0, 911, 3}, {2064, 6, 0, 914, 3},
+		{2070, 6, 0, 917, 3}, {2076, 5, 0, 920, 2}, {2081, 6, 1, 922, 2}, {2087, 11, 0, 924, 3},
+		{2098, 6, 0, 927, 3}, {2104, 4, 1, 930, 2}, {2108, 2, 0, 932, 3}, {2110, 6, 0, 935, 2},
+		{2116, 5, 0, 937, 2}, {2121, 6, 0, 939, 3}, {2127, 8, 0, 942, 2}, {2135, 3, 0, 944, 4},
+		{2138, 6, 0, 948, 3}, {2144, 17, 0, 951, 3}, {2161, 4, 0, 954, 2}, {2165, 6, 0, 956, 3},
+		{2171, 13, 0, 959, 3}, {2184, 6, 0, 962, 3}, {2190, 5, 0, 965, 3}, {2195, 10, 0, 968, 3},
+		{2205, 8, 0, 971, 3}, {2213, 6, 0, 974, 3}, {2219, 6, 0, 977, 2}, {2225, 5, 0, 979, 5},
+		{2230, 3, 0, 984, 2}, {2233, 7, 0, 986, 3}, {2240, 8, 0, 989, 3}, {2248, 3, 0, 992, 2},
+		{2251, 6, 0, 994, 3}, {2257, 17, 0, 997, 3}, {2274, 9, 0, 1000, 3}, {2283, 5, 0, 1003, 2},
+		{2288, 7, 0, 1005, 3}, {2295, 3, 0, 1008, 2}, {2298, 6, 0, 1010, 3}, {2304, 5, 0, 1013, 3},
+		{2309, 5, 0, 1016, 3}, {2314, 6, 0, 1019, 3}, {2320, 6, 0, 1022, 2}, {2326, 3, 0, 1024, 3},
+		{2329, 4, 0, 1027, 1}, {2333, 6, 0, 1028, 5}, {2339, 4, 0, 1033, 3}, {2343, 13, 0, 1036, 3},
+		{2356, 3, 0, 1039, 3}, {2359, 10, 0, 1042, 3}, {2369, 5, 0, 1045, 2}, {2374, 10, 0, 1047, 3},
+		{2384, 6, 0, 1050, 2}, {2390, 6, 0, 1052, 3}, {2396, 6, 0, 1055, 3}, {2402, 7, 0, 1058, 3},
+		{2409, 3, 0, 1061, 2}, {2412, 6, 0, 1063, 3}, {2418, 4, 0, 1066, 3}, {2422, 7, 0, 1069, 3},
+		{2429, 4, 0, 1072, 3}, {2433, 4, 0, 1075, 4}, {2437, 18, 0, 1079, 3}, {2455, 7, 0, 1082, 5},
+		{2462, 5, 0, 1087, 3}, {2467, 6, 0, 1090, 2}, {2473, 6, 0, 1092, 3}, {2479, 5, 0, 1095, 3},
+		{2484, 8, 0, 1098, 3}, {2492, 3, 0, 1101, 5}, {2495, 7, 0, 1106, 2}, {2502, 6, 0, 1108, 3},
+		{2508, 7, 0, 1111, 3}, {2515, 5, 0, 1114, 3}, {2520, 4, 0, 1117, 3}, {2524, 2, 0, 1120, 3},
+		{2526, 6, 0, 1123, 2}, {2532, 5, 0, 1125, 3}, {2537, 5, 0, 1128, 3}, {2542, 6, 1, 1131, 2},
+		{2548, 7, 0, 1133, 3}, {2555, 9, 0, 1136, 5}, {2564, 5, 0, 1141, 2}, {2569, 13, 0, 1143, 3},
+		{2582, 6, 0, 1146, 2}, {2588, 17, 0, 1148, 3}, {2605, 3, 0, 1151, 4}, {2608, 5, 0, 1155, 2},
+		{2613, 6, 0, 1157, 3}, {2619, 5, 0, 1160, 3}, {2624, 3, 0, 1163, 3}, {2627, 7, 0, 1166, 6},
+		{2634, 8, 0, 1172, 3}, {2642, 20, 0, 1175, 3}, {2662, 5, 0, 1178, 3}, {2667, 4, 0, 1181, 4},
+		{2671, 5, 0, 1185, 3}, {2676, 6, 0, 1188, 2}, {2682, 7, 0, 1190, 3}, {2689, 7, 0, 1193, 3},
+		{2696, 4, 0, 1196, 2}, {2700, 4, 0, 1198, 6}, {2704, 6, 1, 1204, 2}, {2710, 3, 0, 1206, 2},
+		{2713, 20, 0, 1208, 3}, {2733, 12, 0, 1211, 3}, {2745, 5, 0, 1214, 3}, {2750, 8, 0, 1217, 3},
+		{2758, 7, 0, 1220, 3}, {2765, 6, 0, 1223, 3}, {2771, 5, 0, 1226, 2}, {2776, 22, 0, 1228, 3},
+		{2798, 11, 0, 1231, 3}, {2809, 6, 0, 1234, 3}, {2815, 5, 1, 1237, 2}, {2820, 5, 0, 1239, 6},
+		{2825, 3, 1, 1245, 2}, {2828, 4, 0, 1247, 3}, {2832, 9, 0, 1250, 3}, {2841, 4, 0, 1253, 3},
+		{2845, 3, 0, 1256, 3}, {2848, 5, 0, 1259, 2}, {2853, 9, 0, 1261, 3}, {2862, 6, 1, 1264, 2},
+		{2868, 5, 0, 1266, 2}, {2873, 3, 0, 1268, 4}, {2876, 17, 0, 1272, 3}, {2893, 4, 0, 1275, 3},
+		{2897, 6, 0, 1278, 3}, {2903, 6, 0, 1281, 6}, {2909, 6, 0, 1287, 2}, {2915, 17, 0, 1289, 3},
+		{2932, 6, 0, 1292, 3}, {2938, 6, 0, 1295, 3}, {2944, 4, 0, 1298, 3}, {2948, 3, 0, 1301, 3},
+		{2951, 7, 0, 1304, 2}, {2958, 11, 0, 1306, 3}, {2969, 10, 0, 1309, 3}, {2979, 2, 0, 1312, 3},
+		{2981, 16, 0, 1315, 3}, {2997, 3, 0, 1318, 4}, {3000, 3, 0, 1322, 4}, {3003, 4, 0, 1326, 2},
+		{3007, 4, 0, 1328, 3}, {3011, 5, 0, 1331, 3}, {3016, 7, 0, 1334, 3}, {3023, 5, 0, 1337, 3},
+		{3028, 9, 0, 1340, 3}, {3037, 15, 0, 1343, 3}, {3052, 5, 0, 1346, 3}, {3057, 4, 0, 1349, 1},
+		{3061, 5, 0, 1350, 3}, {3066, 4, 0, 1353, 4}, {3070, 7, 0, 1357, 3}, {3077, 3, 0, 1360, 2},
+		{3080, 5, 0, 1362, 2}, {3085, 3, 0, 1364, 4}, {3088, 7, 0, 1368, 3}, {3095, 17, 0, 1371, 3},
+		{3112, 8, 0, 1374, 3}, {3120, 5, 0, 1377, 3}, {3125, 5, 0, 1380, 3}, {3130, 14, 0, 1383, 3},
+		{3144, 13, 0, 1386, 3}, {3157, 5, 1, 1389, 2}, {3162, 5, 0, 1391, 2}, {3167, 7, 0, 1393, 3},
+		{3174, 9, 0, 1396, 3}, {3183, 6, 0, 1399, 6}, {3189, 3, 0, 1405, 3}, {3192, 6, 0, 1408, 2},
+		{3198, 2, 0, 1410, 3}, {3200, 6, 0, 1413, 3}, {3206, 5, 0, 1416, 3}, {3211, 3, 0, 1419, 2},
+		{3214, 4, 0, 1421, 4}, {3218, 4, 0, 1425, 3}, {3222, 4, 0, 1428, 2}, {3226, 8, 0, 1430, 3},
+		{3234, 4, 0, 1433, 2}, {3238, 12, 0, 1435, 3}, {3250, 4, 0, 1438, 4}, {3254, 3, 0, 1442, 2},
+		{3257, 7, 0, 1444, 3}, {3264, 3, 0, 1447, 4}, {3267, 8, 0, 1451, 3}, {3275, 4, 0, 1454, 2},
+		{3279, 5, 0, 1456, 2}, {3284, 5, 0, 1458, 3}, {3289, 4, 0, 1461, 3}, {3293, 6, 0, 1464, 3},
+		{3299, 5, 0, 1467, 2}, {3304, 9, 0, 1469, 3}, {3313, 6, 0, 1472, 3}, {3319, 12, 0, 1475, 3},
+		{3331, 5, 0, 1478, 2}, {3336, 6, 1, 1480, 2}, {3342, 5, 0, 1482, 3}, {3347, 5, 0, 1485, 3},
+		{3352, 4, 0, 1488, 3}, {3356, 6, 0, 1491, 6}, {3362, 3, 0, 1497, 2}, {3365, 6, 0, 1499, 3},
+		{3371, 5, 0, 1502, 2}, {3376, 6, 0, 1504, 3}, {3382, 4, 0, 1507, 3}, {3386, 9, 0, 1510, 3},
+		{3395, 5, 0, 1513, 3}, {3400, 5, 0, 1516, 3}, {3405, 4, 0, 1519, 4}, {3409, 5, 0, 1523, 3},
+		{3414, 3, 0, 1526, 3}, {3417, 6, 0, 1529, 3}, {3423, 6, 0, 1532, 2}, {3429, 8, 0, 1534, 3},
+		{3437, 5, 0, 1537, 3}, {3442, 5, 0, 1540, 3}, {3447, 4, 0, 1543, 3}, {3451, 17, 0, 1546, 3},
+		{3468, 4, 0, 1549, 3}, {3472, 5, 0, 1552, 5}, {3477, 8, 0, 1557, 3}, {3485, 5, 0, 1560, 3},
+		{3490, 3, 0, 1563, 4}, {3493, 4, 0, 1567, 3}, {3497, 5, 1, 1570, 2}, {3502, 6, 0, 1572, 3},
+		{3508, 14, 0, 1575, 3}, {3522, 6, 0, 1578, 3}, {3528, 19, 0, 1581, 3}, {3547, 7, 0, 1584, 6},
+		{3554, 2, 0, 1590, 2}, {3556, 6, 0, 1592, 3}, {3562, 16, 0, 1595, 5}, {3578, 7, 0, 1600, 3},
+		{3585, 4, 0, 1603, 3}, {3589, 4, 0, 1606, 2}, {3593, 5, 0, 1608, 3}, {3598, 3, 0, 1611, 3},
+		{3601, 5, 0, 1614, 3}, {3606, 15, 0, 1617, 3}, {3621, 5, 0, 1620, 3}, {3626, 13, 0, 1623, 3},
+		{3639, 6, 0, 1626, 2}, {3645, 15, 0, 1628, 3}, {3660, 14, 0, 1631, 3}, {3674, 6, 0, 1634, 2},
+		{3680, 6, 0, 1636, 3}, {3686, 6, 0, 1639, 2}, {3692, 12, 0, 1641, 3}, {3704, 16, 0, 1644, 3},
+		{3720, 14, 0, 1647, 3}, {3734, 13, 0, 1650, 3}, {3747, 15, 0, 1653, 3}, {3762, 4, 0, 1656, 3},
+		{3766, 5, 0, 1659, 3}, {3771, 9, 0, 1662, 6}, {3780, 5, 0, 1668, 3}, {3785, 3, 0, 1671, 3},
+		{3788, 4, 0, 1674, 3}, {3792, 2, 0, 1677, 3}, {3794, 3, 0, 1680, 2}, {3797, 6, 0, 1682, 3},
+		{3803, 6, 1, 1685, 2}, {3809, 6, 0, 1687, 2}, {3815, 4, 0, 1689, 5}, {3819, 9, 0, 1694, 2},
+		{3828, 18, 0, 1696, 5}, {3846, 5, 0, 1701, 3}, {3851, 16, 0, 1704, 3}, {3867, 5, 0, 1707, 3},
+		{3872, 6, 0, 1710, 3}, {3878, 6, 0, 1713, 1}, {3884, 6, 0, 1714, 3}, {3890, 3, 0, 1717, 2},
+		{3893, 3, 0, 1719, 2}, {3896, 7, 0, 1721, 3}, {3903, 6, 0, 1724, 3}, {3909, 6, 0, 1727, 2},
+		{3915, 5, 0, 1729, 3}, {3920, 5, 0, 1732, 3}, {3925, 4, 0, 1735, 3}, {3929, 11, 0, 1738, 3},
+		{3940, 4, 0, 1741, 4}, {3944, 12, 0, 1745, 3}, {3956, 4, 0, 1748, 4}, {3960, 4, 0, 1752, 3},
+		{3964, 4, 0, 1755, 3}, {3968, 14, 0, 1758, 3}, {3982, 8, 0, 1761, 3}, {3990, 16, 0, 1764, 5},
+		{4006, 14, 0, 1769, 3}, {4020, 5, 0, 1772, 3}, {4025, 5, 0, 1775, 3}, {4030, 8, 0, 1778, 3},
+		{4038, 6, 0, 1781, 3}, {4044, 5, 0, 1784, 2}, {4049, 3, 0, 1786, 1}, {4052, 5, 0, 1787, 3},
+		{4057, 17, 0, 1790, 3}, {4074, 3, 0, 1793, 3}, {4077, 6, 0, 1796, 2}, {4083, 5, 0, 1798, 3},
+		{4088, 6, 0, 1801, 3}, {4094, 4, 0, 1804, 3}, {4098, 9, 0, 1807, 6}, {4107, 10, 0, 1813, 3},
+		{4117, 6, 0, 1816, 2}, {4123, 4, 0, 1818, 2}, {4127, 3, 0, 1820, 3}, {4130, 8, 0, 1823, 3},
+		{4138, 6, 0, 1826, 3}, {4144, 11, 0, 1829, 3}, {4155, 10, 0, 1832, 3}, {4165, 14, 0, 1835, 3},
+		{4179, 17, 0, 1838, 3}, {4196, 4, 0, 1841, 4}, {4200, 4, 0, 1845, 4}, {4204, 4, 1, 1849, 2},
+		{4208, 18, 0, 1851, 3}, {4226, 6, 0, 1854, 3}, {4232, 5, 0, 1857, 3}, {4237, 15, 0, 1860, 3},
+		{4252, 8, 0, 1863, 3}, {4260, 4, 0, 1866, 3}, {4264, 5, 1, 1869, 2}, {4269, 3, 0, 1871, 3},
+		{4272, 6, 0, 1874, 3}, {4278, 7, 0, 1877, 3}, {4285, 6, 0, 1880, 3}, {4291, 6, 0, 1883, 3},
+		{4297, 3, 0, 1886, 4}, {4300, 6, 0, 1890, 3}, {4306, 17, 0, 1893, 5}, {4323, 2, 0, 1898, 3},
+		{4325, 8, 0, 1901, 3}, {4333, 5, 0, 1904, 3}, {4338, 2, 0, 1907, 3}, {4340, 4, 1, 1910, 2},
+		{4344, 18, 0, 1912, 3}, {4362, 6, 0, 1915, 2}, {4368, 6, 0, 1917, 3}, {4374, 6, 0, 1920, 3},
+		{4380, 5, 0, 1923, 2}, {4385, 4, 0, 1925, 4}, {4389, 6, 0, 1929, 3}, {4395, 6, 0, 1932, 3},
+		{4401, 3, 0, 1935, 2}, {4404, 4, 0, 1937, 3}, {4408, 7, 0, 1940, 3}, {4415, 5, 0, 1943, 3},
+		{4420, 4, 0, 1946, 4}, {4424, 6, 0, 1950, 3}, {4430, 6, 0, 1953, 3}, {4436, 3, 0, 1956, 2},
+		{4439, 15, 0, 1958, 3}, {4454, 13, 0, 1961, 3}, {4467, 5, 0, 1964, 3}, {4472, 21, 0, 1967, 3},
+		{4493, 3, 1, 1970, 2}, {4496, 2, 0, 1972, 3}, {4498, 5, 0, 1975, 3}, {4503, 18, 0, 1978, 3},
+		{4521, 5, 0, 1981, 3}, {4526, 13, 0, 1984, 3}, {4539, 4, 0, 1987, 3}, {4543, 5, 0, 1990, 2},
+		{4548, 4, 0, 1992, 3}, {4552, 5, 0, 1995, 2}, {4557, 12, 0, 1997, 3}, {4569, 5, 0, 2000, 2},
+		{4574, 7, 0, 2002, 3}, {4581, 11, 0, 2005, 3}, {4592, 6, 0, 2008, 3}, {4598, 3, 0, 2011, 4},
+		{4601, 6, 0, 2015, 3}, {4607, 4, 0, 2018, 3}, {4611, 4, 0, 2021, 6}, {4615, 6, 0, 2027, 3},
+		{4621, 4, 0, 2030, 4}, {4625, 5, 0, 2034, 3}, {4630, 6, 0, 2037, 1}, {4636, 6, 0, 2038, 3},
+		{4642, 4, 0, 2041, 4}, {4646, 4, 0, 2045, 2}, {4650, 6, 0, 2047, 2}, {4656, 7, 0, 2049, 3},
+		{4663, 4, 0, 2052, 3}, {4667, 8, 0, 2055, 3}, {4675, 5, 0, 2058, 2}, {4680, 2, 0, 2060, 3},
+		{4682, 12, 0, 2063, 3}, {4694, 10, 0, 2066, 3}, {4704, 5, 0, 2069, 3}, {4709, 4, 0, 2072, 4},
+		{4713, 7, 0, 2076, 3}, {4720, 7, 0, 2079, 3}, {4727, 5, 0, 2082, 3}, {4732, 4, 0, 2085, 4},
+		{4736, 3, 0, 2089, 2}, {4739, 3, 0, 2091, 4}, {4742, 5, 0, 2095, 3}, {4747, 6, 0, 2098, 3},
+		{4753, 8, 0, 2101, 3}, {4761, 6, 0, 2104, 1}, {4767, 5, 0, 2105, 2}, {4772, 3, 0, 2107, 3},
+		{4775, 4, 0, 2110, 2}, {4779, 4, 0, 2112, 3}, {4783, 16, 0, 2115, 1}, {4799, 5, 0, 2116, 6},
+		{4804, 4, 0, 2122, 3}, {4808, 5, 0, 2125, 2}, {4813, 6, 0, 2127, 2}, {4819, 3, 0, 2129, 3},
+		{4822, 7, 0, 2132, 3}, {4829, 6, 0, 2135, 2}, {4835, 12, 0, 2137, 3}, {4847, 6, 0, 2140, 3},
+		{4853, 4, 0, 2143, 4}, {4857, 3, 0, 2147, 4}, {4860, 7, 0, 2151, 3}, {4867, 4, 0, 2154, 3},
+		{4871, 7, 0, 2157, 3}, {4878, 4, 0, 2160, 4}, {4882, 2, 0, 2164, 3}, {4884, 10, 0, 2167, 3},
+		{4894, 4, 0, 2170, 3}, {4898, 14, 0, 2173, 3}, {4912, 17, 0, 2176, 3}, {4929, 6, 0, 2179, 3},
+		{4935, 6, 0, 2182, 3}, {4941, 8, 0, 2185, 3}, {4949, 7, 0, 2188, 3}, {4956, 5, 0, 2191, 3},
+		{4961, 6, 0, 2194, 3}, {4967, 4, 0, 2197, 2}, {4971, 3, 0, 2199, 3}, {4974, 6, 0, 2202, 3},
+		{4980, 17, 0, 2205, 3}, {4997, 4, 0, 2208, 2}, {5001, 6, 0, 2210, 3}, {5007, 6, 0, 2213, 2},
+		{5013, 7, 0, 2215, 3}, {5020, 6, 0, 2218, 3}, {5026, 11, 0, 2221, 3}, {5037, 31, 0, 2224, 3},
+		{5068, 12, 0, 2227, 3}, {5080, 5, 0, 2230, 3}, {5085, 4, 0, 2233, 5}, {5089, 8, 0, 2238, 3},
+		{5097, 2, 0, 2241, 3}, {5099, 6, 0, 2244, 3}, {5105, 7, 0, 2247, 3}, {5112, 4, 0, 2250, 3},
+		{5116, 4, 0, 2253, 2}, {5120, 6, 0, 2255, 3}, {5126, 4, 0, 2258, 4}, {5130, 9, 0, 2262, 5},
+		{5139, 2, 0, 2267, 3}, {5141, 4, 0, 2270, 4}, {5145, 10, 0, 2274, 3}, {5155, 6, 0, 2277, 3},
+		{5161, 3, 0, 2280, 2}, {5164, 5, 0, 2282, 2}, {5169, 5, 0, 2284, 3}, {5174, 4, 0, 2287, 3},
+		{5178, 5, 0, 2290, 3}, {5183, 3, 0, 2293, 4}, {5186, 21, 0, 2297, 3}, {5207, 8, 0, 2300, 3},
+		{5215, 4, 0, 2303, 4}, {5219, 5, 0, 2307, 3}, {5224, 8, 0, 2310, 3}, {5232, 5, 0, 2313, 3},
+		{5237, 6, 0, 2316, 3}, {5243, 6, 0, 2319, 3}, {5249, 4, 0, 2322, 3}, {5253, 5, 0, 2325, 3},
+		{5258, 6, 1, 2328, 2}, {5264, 11, 0, 2330, 3}, {5275, 6, 1, 2333, 2}, {5281, 4, 0, 2335, 1},
+		{5285, 4, 0, 2336, 6}, {5289, 5, 0, 2342, 2}, {5294, 6, 0, 2344, 3}, {5300, 18, 0, 2347, 3},
+		{5318, 7, 0, 2350, 3}, {5325, 5, 0, 2353, 3}, {5330, 4, 0, 2356, 3}, {5334, 11, 0, 2359, 3},
+		{5345, 4, 0, 2362, 3}, {5349, 7, 0, 2365, 3}, {5356, 3, 0, 2368, 4}, {5359, 5, 0, 2372, 3},
+		{5364, 3, 0, 2375, 2}, {5367, 3, 0, 2377, 3}, {5370, 4, 0, 2380, 3}, {5374, 7, 0, 2383, 3},
+		{5381, 4, 0, 2386, 3}, {5385, 6, 0, 2389, 3}, {5391, 7, 0, 2392, 3}, {5398, 5, 0, 2395, 3},
+		{5403, 5, 0, 2398, 2}, {5408, 4, 0, 2400, 3}, {5412, 4, 0, 2403, 4}, {5416, 7, 0, 2407, 3},
+		{5423, 3, 0, 2410, 2}, {5426, 14, 0, 2412, 3}, {5440, 10, 0, 2415, 3}, {5450, 4, 0, 2418, 4},
+		{5454, 5, 0, 2422, 3}, {5459, 7, 0, 2425, 3}, {5466, 5, 1, 2428, 2}, {5471, 8, 0, 2430, 3},
+		{5479, 5, 0, 2433, 3}, {5484, 11, 0, 2436, 3}, {5495, 4, 0, 2439, 3}, {5499, 4, 0, 2442, 4},
+		{5503, 7, 0, 2446, 3}, {5510, 6, 0, 2449, 3}, {5516, 2, 1, 2452, 1}, {5518, 3, 1, 2453, 2},
+		{5521, 6, 0, 2455, 5}, {5527, 7, 0, 2460, 3}, {5534, 15, 0, 2463, 3}, {5549, 2, 0, 2466, 3},
+		{5551, 6, 0, 2469, 3}, {5557, 4, 0, 2472, 3}, {5561, 8, 0, 2475, 3}, {5569, 3, 0, 2478, 3},
+		{5572, 6, 0, 2481, 3}, {5578, 5, 1, 2484, 2}, {5583, 2, 0, 2486, 3}, {5585, 10, 0, 2489, 3},
+		{5595, 6, 1, 2492, 2}, {5601, 21, 0, 2494, 3}, {5622, 3, 0, 2497, 4}, {5625, 5, 0, 2501, 3},
+		{5630, 8, 0, 2504, 3}, {5638, 6, 0, 2507, 3}, {5644, 4, 0, 2510, 3}, {5648, 4, 1, 2513, 2},
+		{5652, 5, 0, 2515, 3}, {5657, 10, 0, 2518, 3}, {5667, 5, 0, 2521, 3}, {5672, 4, 0, 2524, 4},
+		{5676, 8, 0, 2528, 1}, {5684, 3, 0, 2529, 2}, {5687, 7, 0, 2531, 3}, {5694, 4, 0, 2534, 3},
+		{5698, 7, 0, 2537, 3}, {5705, 4, 0, 2540, 4}, {5709, 6, 0, 2544, 3}, {5715, 6, 0, 2547, 2},
+		{5721, 5, 1, 2549, 2}, {5726, 14, 0, 2551, 3}, {5740, 14, 0, 2554, 3}, {5754, 4, 0, 2557, 4},
+		{5758, 4, 0, 2561, 3}, {5762, 6, 1, 2564, 2}, {5768, 17, 0, 2566, 3}, {5785, 4, 0, 2569, 4},
+		{5789, 6, 1, 2573, 2}, {5795, 4, 0, 2575, 3}, {5799, 4, 0, 2578, 2}, {5803, 5, 0, 2580, 3},
+		{5808, 6, 0, 2583, 2}, {5814, 2, 0, 2585, 3}, {5816, 3, 0, 2588, 2}, {5819, 20, 0, 2590, 3},
+		{5839, 4, 0, 2593, 3}, {5843, 2, 0, 2596, 3}, {5845, 5, 0, 2599, 2}, {5850, 5, 0, 2601, 3},
+		{5855, 3, 0, 2604, 1}, {5858, 5, 0, 2605, 3}, {5863, 6, 0, 2608, 3}, {5869, 6, 0, 2611, 2},
+		{5875, 3, 0, 2613, 2}, {5878, 14, 0, 2615, 3}, {5892, 5, 0, 2618, 3}, {5897, 4, 0, 2621, 3},
+		{5901, 9, 0, 2624, 3}, {5910, 7, 0, 2627, 3}, {5917, 4, 0, 2630, 2}, {5921, 23, 0, 2632, 5},
+		{5944, 15, 0, 2637, 3}, {5959, 5, 0, 2640, 3}, {5964, 6, 0, 2643, 3}, {5970, 7, 0, 2646, 3},
+		{5977, 3, 1, 2649, 1}, {5980, 4, 0, 2650, 4}, {5984, 8, 0, 2654, 3}, {5992, 6, 0, 2657, 3},
+		{5998, 5, 0, 2660, 3}, {6003, 20, 0, 2663, 3}, {6023, 5, 0, 2666, 3}, {6028, 13, 0, 2669, 6},
+		{6041, 7, 0, 2675, 3}, {6048, 6, 0, 2678, 3}, {6054, 6, 0, 2681, 2}, {6060, 11, 0, 2683, 3},
+		{6071, 10, 0, 2686, 3}, {6081, 4, 0, 2689, 3}, {6085, 4, 0, 2692, 3}, {6089, 6, 0, 2695, 2},
+		{6095, 6, 0, 2697, 3}, {6101, 4, 0, 2700, 1}, {6105, 4, 1, 2701, 1}, {6109, 6, 0, 2702, 3},
+		{6115, 14, 0, 2705, 3}, {6129, 5, 0, 2708, 3}, {6134, 5, 0, 2711, 5}, {6139, 5, 0, 2716, 3},
+		{6144, 5, 0, 2719, 2}, {6149, 6, 1, 2721, 2}, {6155, 4, 0, 2723, 3}, {6159, 4, 0, 2726, 3},
+		{6163, 6, 1, 2729, 2}, {6169, 5, 0, 2731, 3}, {6174, 6, 0, 2734, 1}, {6180, 4, 0, 2735, 3},
+		{6184, 6, 0, 2738, 2}, {6190, 3, 0, 2740, 2}, {6193, 10, 0, 2742, 3}, {6203, 6, 0, 2745, 2},
+		{6209, 10, 0, 2747, 3}, {6219, 6, 0, 2750, 3}, {6225, 8, 0, 2753, 3}, {6233, 6, 0, 2756, 2},
+		{6239, 6, 0, 2758, 3}, {6245, 5, 1, 2761, 2}, {6250, 5, 0, 2763, 1}, {6255, 3, 0, 2764, 2},
+		{6258, 6, 0, 2766, 2}, {6264, 5, 1, 2768, 2}, {6269, 4, 0, 2770, 3}, {6273, 7, 0, 2773, 3},
+		{6280, 11, 0, 2776, 3}, {6291, 8, 0, 2779, 3}, {6299, 4, 0, 2782, 2}, {6303, 6, 0, 2784, 3},
+		{6309, 5, 0, 2787, 3}, {6314, 5, 0, 2790, 2}, {6319, 5, 0, 2792, 2}, {6324, 4, 0, 2794, 4},
+		{6328, 4, 0, 2798, 3}, {6332, 6, 0, 2801, 2}, {6338, 3, 0, 2803, 3}, {6341, 4, 0, 2806, 3},
+		{6345, 8, 0, 2809, 3}, {6353, 5, 0, 2812, 3}, {6358, 4, 1, 2815, 2}, {6362, 6, 0, 2817, 3},
+		{6368, 6, 0, 2820, 3}, {6374, 15, 0, 2823, 3}, {6389, 11, 0, 2826, 2}, {6400, 4, 0, 2828, 5},
+		{6404, 14, 0, 2833, 3}, {6418, 4, 0, 2836, 3}, {6422, 3, 0, 2839, 3}, {6425, 5, 0, 2842, 3},
+		{6430, 4, 0, 2845, 4}, {6434, 3, 0, 2849, 3}, {6437, 7, 0, 2852, 3}, {6444, 6, 0, 2855, 3},
+		{6450, 8, 0, 2858, 3}, {6458, 8, 0, 2861, 3}, {6466, 6, 1, 2864, 2}, {6472, 14, 0, 2866, 3},
+		{6486, 7, 0, 2869, 3}, {6493, 16, 0, 2872, 3}, {6509, 3, 0, 2875, 4}, {6512, 8, 0, 2879, 3},
+		{6520, 6, 1, 2882, 2}, {6526, 6, 0, 2884, 2}, {6532, 2, 0, 2886, 3}, {6534, 6, 0, 2889, 3},
+		{6540, 10, 0, 2892, 3}, {6550, 6, 0, 2895, 3}, {6556, 6, 0, 2898, 2}, {6562, 5, 0, 2900, 2},
+		{6567, 4, 0, 2902, 2}, {6571, 6, 1, 2904, 2}, {6577, 7, 0, 2906, 3}, {6584, 10, 0, 2909, 3},
+		{6594, 3, 0, 2912, 4}, {6597, 3, 0, 2916, 4}, {6600, 6, 0, 2920, 3}, {6606, 3, 0, 2923, 4},
+		{6609, 6, 1, 2927, 2}, {6615, 4, 0, 2929, 3}, {6619, 3, 1, 2932, 2}, {6622, 7, 0, 2934, 3},
+		{6629, 12, 0, 2937, 3}, {6641, 6, 0, 2940, 3}, {6647, 5, 0, 2943, 3}, {6652, 5, 0, 2946, 3},
+		{6657, 13, 0, 2949, 6}, {6670, 5, 0, 2955, 3}, {6675, 4, 0, 2958, 4}, {6679, 4, 0, 2962, 4},
+		{6683, 6, 0, 2966, 3}, {6689, 6, 0, 2969, 3}, {6695, 3, 0, 2972, 5}, {6698, 5, 0, 2977, 3},
+		{6703, 5, 0, 2980, 3}, {6708, 18, 0, 2983, 3}, {6726, 13, 0, 2986, 3}, {6739, 6, 0, 2989, 3},
+		{6745, 5, 1, 2992, 2}, {6750, 5, 0, 2994, 3}, {6755, 5, 0, 2997, 3}, {6760, 6, 0, 3000, 3},
+		{6766, 6, 0, 3003, 3}, {6772, 5, 0, 3006, 3}, {6777, 5, 0, 3009, 3}, {6782, 14, 0, 3012, 3},
+		{6796, 4, 0, 3015, 4}, {6800, 2, 0, 3019, 2}, {6802, 6, 0, 3021, 3}, {6808, 4, 0, 3024, 3},
+		{6812, 8, 0, 3027, 3}, {6820, 6, 0, 3030, 2}, {6826, 3, 1, 3032, 2}, {6829, 5, 0, 3034, 2},
+		{6834, 4, 1, 3036, 2}, {6838, 19, 0, 3038, 3}, {6857, 11, 0, 3041, 3}, {6868, 9, 0, 3044, 2},
+		{6877, 6, 0, 3046, 2}, {6883, 3, 0, 3048, 2}, {6886, 3, 0, 3050, 3}, {6889, 6, 0, 3053, 3},
+		{6895, 6, 0, 3056, 2}, {6901, 5, 0, 3058, 2}, {6906, 5, 0, 3060, 3}, {6911, 5, 0, 3063, 3},
+		{6916, 4, 0, 3066, 3}, {6920, 5, 0, 3069, 3}, {6925, 5, 0, 3072, 3}, {6930, 10, 0, 3075, 3},
+		{6940, 5, 0, 3078, 3}, {6945, 5, 0, 3081, 3}, {6950, 5, 0, 3084, 3}, {6955, 2, 0, 3087, 3},
+		{6957, 16, 0, 3090, 2}, {6973, 13, 0, 3092, 5}, {6986, 9, 0, 3097, 3}, {6995, 9, 0, 3100, 3},
+		{7004, 5, 0, 3103, 3}, {7009, 6, 0, 3106, 2}, {7015, 5, 0, 3108, 3}, {7020, 16, 0, 3111, 2},
+		{7036, 8, 0, 3113, 3}, {7044, 4, 0, 3116, 1}, {7048, 6, 0, 3117, 2}, {7054, 4, 1, 3119, 2},
+		{7058, 7, 0, 3121, 3}, {7065, 5, 0, 3124, 3}, {7070, 7, 0, 3127, 3}, {7077, 5, 0, 3130, 3},
+		{7082, 11, 0, 3133, 3}, {7093, 15, 0, 3136, 3}, {7108, 4, 0, 3139, 4}, {7112, 6, 0, 3143, 3},
+		{7118, 4, 0, 3146, 3}, {7122, 13, 0, 3149, 3}, {7135, 5, 0, 3152, 3}, {7140, 6, 0, 3155, 1},
+		{7146, 6, 0, 3156, 3}, {7152, 8, 0, 3159, 3}, {7160, 5, 0, 3162, 3}, {7165, 5, 0, 3165, 3},
+		{7170, 3, 0, 3168, 3}, {7173, 5, 0, 3171, 3}, {7178, 3, 0, 3174, 2}, {7181, 3, 0, 3176, 2},
+		{7184, 3, 0, 3178, 5}, {7187, 4, 0, 3183, 2}, {7191, 3, 0, 3185, 3}, {7194, 3, 0, 3188, 3},
+		{7197, 5, 0, 3191, 2}, {7202, 4, 0, 3193, 3}, {7206, 5, 0, 3196, 3}, {7211, 5, 0, 3199, 5},
+		{7216, 16, 0, 3204, 2}, {7232, 13, 0, 3206, 3}, {7245, 5, 0, 3209, 3}, {7250, 5, 0, 3212, 3},
+		{7255, 21, 0, 3215, 3}, {7276, 10, 0, 3218, 5}, {7286, 4, 0, 3223, 3}, {7290, 3, 0, 3226, 3},
+		{7293, 7, 0, 3229, 3}, {7300, 3, 0, 3232, 2}, {7303, 4, 0, 3234, 4}, {7307, 17, 0, 3238, 3},
+		{7324, 7, 0, 3241, 3}, {7331, 11, 0, 3244, 3}, {7342, 5, 0, 3247, 3}, {7347, 4, 0, 3250, 4},
+		{7351, 11, 0, 3254, 3}, {7362, 4, 0, 3257, 3}, {7366, 13, 0, 3260, 3}, {7379, 6, 0, 3263, 3},
+		{7385, 6, 0, 3266, 3}, {7391, 4, 0, 3269, 4}, {7395, 5, 0, 3273, 3}, {7400, 4, 0, 3276, 3},
+		{7404, 6, 0, 3279, 3}, {7410, 5, 0, 3282, 3}, {7415, 4, 0, 3285, 3}, {7419, 6, 1, 3288, 2},
+		{7425, 6, 0, 3290, 2}, {7431, 5, 1, 3292, 2}, {7436, 4, 0, 3294, 6}, {7440, 9, 0, 3300, 3},
+		{7449, 4, 1, 3303, 2}, {7453, 3, 0, 3305, 4}, {7456, 8, 0, 3309, 3}, {7464, 7, 0, 3312, 3},
+		{7471, 5, 0, 3315, 2}, {7476, 6, 0, 3317, 2}, {7482, 6, 0, 3319, 2}, {7488, 3, 0, 3321, 3},
+		{7491, 4, 0, 3324, 3}, {7495, 5, 0, 3327, 2}, {7500, 4, 0, 3329, 3}, {7504, 6, 0, 3332, 3},
+		{7510, 24, 0, 3335, 3}, {7534, 6, 0, 3338, 3}, {7540, 6, 0, 3341, 2}, {7546, 7, 0, 3343, 2},
+		{7553, 15, 0, 3345, 3}, {7568, 5, 0, 3348, 3}, {7573, 6, 0, 3351, 3}, {7579, 3, 0, 3354, 4},
+		{7582, 5, 0, 3358, 3}, {7587, 10, 0, 3361, 3}, {7597, 6, 0, 3364, 3}, {7603, 3, 0, 3367, 3},
+		{7606, 3, 0, 3370, 3}, {7609, 3, 0, 3373, 4}, {7612, 3, 0, 3377, 2}, {7615, 6, 0, 3379, 3},
+		{7621, 6, 0, 3382, 3}, {7627, 4, 0, 3385, 4}, {7631, 6, 0, 3389, 3}, {7637, 5, 0, 3392, 3},
+		{7642, 4, 0, 3395, 4}, {7646, 4, 0, 3399, 2}, {7650, 5, 0, 3401, 3}, {7655, 5, 0, 3404, 3},
+		{7660, 13, 0, 3407, 3}, {7673, 6, 0, 3410, 3}, {7679, 5, 0, 3413, 3}, {7684, 4, 0, 3416, 3},
+		{7688, 2, 0, 3419, 2}, {7690, 7, 0, 3421, 3}, {7697, 3, 0, 3424, 2}, {7700, 5, 0, 3426, 3},
+		{7705, 5, 1, 3429, 2}, {7710, 21, 0, 3431, 3}, {7731, 13, 0, 3434, 3}, {7744, 6, 0, 3437, 3},
+		{7750, 4, 0, 3440, 2}, {7754, 6, 0, 3442, 3}, {7760, 4, 0, 3445, 3}, {7764, 8, 0, 3448, 3},
+		{7772, 5, 0, 3451, 3}, {7777, 7, 0, 3454, 3}, {7784, 10, 0, 3457, 3}, {7794, 5, 0, 3460, 2},
+		{7799, 11, 0, 3462, 3}, {7810, 2, 0, 3465, 3}, {7812, 10, 0, 3468, 3}, {7822, 4, 0, 3471, 3},
+		{7826, 5, 0, 3474, 3}, {7831, 3, 0, 3477, 2}, {7834, 4, 0, 3479, 3}, {7838, 4, 0, 3482, 3},
+		{7842, 4, 0, 3485, 5}, {7846, 5, 0, 3490, 3}, {7851, 6, 0, 3493, 2}, {7857, 10, 0, 3495, 3},
+		{7867, 4, 0, 3498, 3}, {7871, 6, 0, 3501, 2}, {7877, 11, 0, 3503, 6}, {7888, 5, 0, 3509, 3},
+		{7893, 2, 0, 3512, 3}, {7895, 5, 0, 3515, 3}, {7900, 4, 0, 3518, 4}, {7904, 6, 0, 3522, 3},
+		{7910, 6, 0, 3525, 2}, {7916, 4, 0, 3527, 3}, {7920, 20, 0, 3530, 3}, {7940, 8, 0, 3533, 3},
+		{7948, 3, 1, 3536, 1}, {7951, 8, 0, 3537, 3}, {7959, 6, 0, 3540, 3}, {7965, 4, 1, 3543, 2},
+		{7969, 8, 0, 3545, 3}, {7977, 6, 0, 3548, 3}, {7983, 7, 0, 3551, 3}, {7990, 4, 0, 3554, 3},
+		{7994, 8, 0, 3557, 3}, {8002, 11, 0, 3560, 3}, {8013, 7, 0, 3563, 3}, {8020, 15, 0, 3566, 3},
+		{8035, 3, 0, 3569, 3}, {8038, 5, 0, 3572, 3}, {8043, 4, 0, 3575, 3}, {8047, 7, 0, 3578, 3},
+		{8054, 7, 0, 3581, 3}, {8061, 6, 0, 3584, 3}, {8067, 9, 0, 3587, 3}, {8076, 4, 0, 3590, 6},
+		{8080, 6, 0, 3596, 3}, {8086, 19, 0, 3599, 3}, {8105, 3, 0, 3602, 3}, {8108, 6, 1, 3605, 2},
+		{8114, 9, 0, 3607, 3}, {8123, 9, 0, 3610, 3}, {8132, 14, 0, 3613, 3}, {8146, 5, 0, 3616, 2},
+		{8151, 2, 0, 3618, 2}, {8153, 8, 0, 3620, 3}, {8161, 5, 0, 3623, 3}, {8166, 6, 0, 3626, 2},
+		{8172, 5, 0, 3628, 3}, {8177, 4, 0, 3631, 2}, {8181, 5, 0, 3633, 3}, {8186, 4, 1, 3636, 2},
+		{8190, 3, 0, 3638, 3}, {8193, 4, 0, 3641, 4}, {8197, 5, 0, 3645, 2}, {8202, 4, 0, 3647, 4},
+		{8206, 7, 0, 3651, 3}, {8213, 15, 0, 3654, 3}, {8228, 7, 0, 3657, 3}, {8235, 7, 0, 3660, 3},
+		{8242, 3, 0, 3663, 3}, {8245, 5, 1, 3666, 2}, {8250, 6, 0, 3668, 3}, {8256, 4, 0, 3671, 6},
+		{8260, 8, 0, 3677, 3}, {8268, 14, 0, 3680, 3}, {8282, 8, 0, 3683, 3}, {8290, 11, 0, 3686, 3},
+		{8301, 4, 0, 3689, 3}, {8305, 5, 0, 3692, 3}, {8310, 4, 0, 3695, 3}, {8314, 5, 0, 3698, 3},
+		{8319, 2, 1, 3701, 1}, {8321, 4, 0, 3702, 1}, {8325, 2, 0, 3703, 3}, {8327, 8, 0, 3706, 3},
+		{8335, 19, 0, 3709, 5}, {8354, 14, 0, 3714, 3}, {8368, 5, 0, 3717, 2}, {8373, 5, 0, 3719, 5},
+		{8378, 13, 0, 3724, 3}, {8391, 6, 0, 3727, 3}, {8397, 5, 0, 3730, 3}, {8402, 5, 0, 3733, 3},
+		{8407, 9, 0, 3736, 3}, {8416, 3, 0, 3739, 4}, {8419, 8, 0, 3743, 2}, {8427, 14, 0, 3745, 3},
+		{8441, 24, 0, 3748, 3}, {8465, 6, 0, 3751, 3}, {8471, 6, 0, 3754, 3}, {8477, 8, 0, 3757, 3},
+		{8485, 13, 0, 3760, 3}, {8498, 4, 1, 3763, 2}, {8502, 8, 0, 3765, 3}, {8510, 13, 0, 3768, 3},
+		{8523, 5, 0, 3771, 3}, {8528, 5, 0, 3774, 3}, {8533, 3, 0, 3777, 2}, {8536, 6, 0, 3779, 3},
+		{8542, 4, 1, 3782, 2}, {8546, 6, 0, 3784, 3}, {8552, 5, 0, 3787, 3}, {8557, 6, 0, 3790, 3},
+		{8563, 6, 0, 3793, 2}, {8569, 17, 0, 3795, 5}, {8586, 6, 0, 3800, 2}, {8592, 11, 0, 3802, 5},
+		{8603, 3, 0, 3807, 3}, {8606, 4, 0, 3810, 2}, {8610, 6, 0, 3812, 6}, {8616, 14, 0, 3818, 3},
+		{8630, 6, 0, 3821, 3}, {8636, 10, 0, 3824, 3}, {8646, 8, 0, 3827, 3}, {8654, 5, 0, 3830, 3},
+		{8659, 3, 0, 3833, 2}, {8662, 5, 0, 3835, 3}, {8667, 5, 0, 3838, 3}, {8672, 8, 0, 3841, 3},
+		{8680, 4, 0, 3844, 3}, {8684, 3, 0, 3847, 3}, {8687, 4, 0, 3850, 3}, {8691, 4, 0, 3853, 3},
+		{8695, 6, 0, 3856, 1}, {8701, 8, 0, 3857, 3}, {8709, 6, 0, 3860, 2}, {8715, 5, 0, 3862, 3},
+		{8720, 5, 0, 3865, 3}, {8725, 6, 0, 3868, 3}, {8731, 8, 0, 3871, 3}, {8739, 5, 0, 3874, 1},
+		{8744, 7, 0, 3875, 3}, {8751, 6, 0, 3878, 3}, {8757, 3, 0, 3881, 3}, {8760, 3, 0, 3884, 4},
+		{8763, 6, 0, 3888, 2}, {8769, 5, 0, 3890, 3}, {8774, 6, 1, 3893, 2}, {8780, 6, 1, 3895, 2},
+		{8786, 8, 0, 3897, 3}, {8794, 14, 0, 3900, 2}, {8808, 5, 0, 3902, 3}, {8813, 5, 0, 3905, 3},
+		{8818, 4, 1, 3908, 2}, {8822, 13, 0, 3910, 3}, {8835, 5, 0, 3913, 3}, {8840, 15, 0, 3916, 3},
+		{8855, 14, 0, 3919, 3}, {8869, 6, 1, 3922, 2}, {8875, 4, 0, 3924, 4}, {8879, 4, 1, 3928, 2},
+		{8883, 6, 0, 3930, 3}, {8889, 4, 0, 3933, 3}, {8893, 6, 0, 3936, 3}, {8899, 4, 0, 3939, 4},
+		{8903, 8, 0, 3943, 3}, {8911, 3, 0, 3946, 3}, {8914, 6, 0, 3949, 2}, {8920, 5, 0, 3951, 6},
+		{8925, 8, 0, 3957, 3}, {8933, 5, 0, 3960, 3}, {8938, 6, 0, 3963, 3}, {8944, 4, 0, 3966, 2},
+		{8948, 5, 0, 3968, 3}, {8953, 4, 0, 3971, 3}, {8957, 5, 0, 3974, 3}, {8962, 7, 0, 3977, 3},
+		{8969, 2, 0, 3980, 3}, {8971, 7, 0, 3983, 3}, {8978, 6, 0, 3986, 3}, {8984, 4, 0, 3989, 2},
+		{8988, 16, 0, 3991, 5}, {9004, 9, 0, 3996, 3}, {9013, 4, 0, 3999, 6}, {9017, 4, 0, 4005, 4},
+		{9021, 7, 0, 4009, 3}, {9028, 6, 0, 4012, 3}, {9034, 4, 0, 4015, 3}, {9038, 7, 0, 4018, 3},
+		{9045, 4, 0, 4021, 2}, {9049, 4, 1, 4023, 1}, {9053, 5, 0, 4024, 3}, {9058, 4, 0, 4027, 4},
+		{9062, 5, 0, 4031, 3}, {9067, 5, 0, 4034, 3}, {9072, 5, 0, 4037, 5}, {9077, 8, 0, 4042, 3},
+		{9085, 4, 0, 4045, 4}, {9089, 5, 0, 4049, 3}, {9094, 4, 0, 4052, 3}, {9098, 8, 0, 4055, 3},
+		{9106, 6, 0, 4058, 3}, {9112, 3, 0, 4061, 3}, {9115, 4, 0, 4064, 3}, {9119, 5, 0, 4067, 3},
+		{9124, 6, 0, 4070, 3}, {9130, 6, 0, 4073, 3}, {9136, 2, 0, 4076, 3}, {9138, 3, 0, 4079, 3},
+		{9141, 8, 0, 4082, 3}, {9149, 2, 0, 4085, 3}, {9151, 9, 0, 4088, 3}, {9160, 5, 0, 4091, 3},
+		{9165, 4, 0, 4094, 2}, {9169, 4, 0, 4096, 5}, {9173, 5, 0, 4101, 2}, {9178, 5, 0, 4103, 2},
+		{9183, 2, 0, 4105, 3}, {9185, 17, 0, 4108, 3}, {9202, 4, 0, 4111, 3}, {9206, 5, 0, 4114, 3},
+		{9211, 7, 0, 4117, 3}, {9218, 5, 0, 4120, 2}, {9223, 3, 0, 4122, 3}, {9226, 4, 0, 4125, 4},
+		{9230, 5, 0, 4129, 3}, {9235, 7, 0, 4132, 3}, {9242, 7, 0, 4135, 3}, {9249, 4, 0, 4138, 3},
+		{9253, 10, 0, 4141, 3}, {9263, 4, 0, 4144, 4}, {9267, 4, 0, 4148, 2}, {9271, 6, 0, 4150, 3},
+		{9277, 5, 0, 4153, 3}, {9282, 4, 0, 4156, 3}, {9286, 16, 0, 4159, 3}, {9302, 5, 0, 4162, 3},
+		{9307, 4, 0, 4165, 3}, {9311, 6, 0, 4168, 3}, {9317, 3, 0, 4171, 4}, {9320, 4, 0, 4175, 2},
+		{9324, 4, 0, 4177, 4}, {9328, 6, 1, 4181, 2}, {9334, 13, 0, 4183, 3}, {9347, 14, 0, 4186, 3},
+		{9361, 3, 0, 4189, 5}, {9364, 3, 0, 4194, 4}, {9367, 4, 0, 4198, 3}, {9371, 4, 0, 4201, 4},
+		{9375, 5, 0, 4205, 2}, {9380, 6, 0, 4207, 3}, {9386, 5, 0, 4210, 3}, {9391, 7, 0, 4213, 6},
+		{9398, 14, 0, 4219, 3}, {9412, 5, 0, 4222, 3}, {9417, 5, 0, 4225, 3}, {9422, 3, 0, 4228, 1},
+		{9425, 4, 0, 4229, 4}, {9429, 13, 0, 4233, 3}, {9442, 6, 0, 4236, 3}, {9448, 11, 0, 4239, 3},
+		{9459, 5, 0, 4242, 3}, {9464, 6, 0, 4245, 3}, {9470, 14, 0, 4248, 3}, {9484, 4, 0, 4251, 3},
+		{9488, 6, 0, 4254, 2}, {9494, 3, 0, 4256, 3}, {9497, 5, 0, 4259, 3}, {9502, 6, 0, 4262, 3},
+		{9508, 3, 0, 4265, 3}, {9511, 8, 0, 4268, 3}, {9519, 3, 1, 4271, 2}, {9522, 4, 0, 4273, 2},
+		{9526, 3, 0, 4275, 3}, {9529, 3, 0, 4278, 3}, {9532, 3, 0, 4281, 3}, {9535, 11, 0, 4284, 3},
+		{9546, 9, 0, 4287, 3}, {9555, 5, 0, 4290, 3}, {9560, 4, 0, 4293, 4}, {9564, 15, 0, 4297, 3},
+		{9579, 5, 0, 4300, 3}, {9584, 14, 0, 4303, 3}, {9598, 3, 0, 4306, 4}, {9601, 5, 0, 4310, 3},
+		{9606, 4, 0, 4313, 2}, {9610, 5, 0, 4315, 2}, {9615, 9, 0, 4317, 3}, {9624, 3, 0, 4320, 3},
+		{9627, 9, 0, 4323, 3}, {9636, 5, 0, 4326, 3}, {9641, 6, 0, 4329, 3}, {9647, 8, 0, 4332, 3},
+		{9655, 15, 0, 4335, 2}, {9670, 5, 1, 4337, 2}, {9675, 6, 0, 4339, 3}, {9681, 4, 0, 4342, 3},
+		{9685, 4, 0, 4345, 3}, {9689, 9, 0, 4348, 3}, {9698, 4, 0, 4351, 3}, {9702, 5, 0, 4354, 3},
+		{9707, 5, 0, 4357, 2}, {9712, 9, 0, 4359, 3}, {9721, 14, 0, 4362, 3}, {9735, 19, 0, 4365, 3},
+		{9754, 9, 0, 4368, 3}, {9763, 3, 0, 4371, 4}, {9766, 5, 0, 4375, 3}, {9771, 9, 0, 4378, 3},
+		{9780, 6, 0, 4381, 5}, {9786, 4, 1, 4386, 2}, {9790, 5, 0, 4388, 3}, {9795, 15, 0, 4391, 3},
+		{9810, 8, 0, 4394, 3}, {9818, 4, 0, 4397, 3}, {9822, 6, 0, 4400, 3}, {9828, 12, 0, 4403, 3},
+		{9840, 10, 0, 4406, 3}, {9850, 4, 0, 4409, 3}, {9854, 5, 0, 4412, 3}, {9859, 5, 0, 4415, 3},
+		{9864, 15, 0, 4418, 3}, {9879, 8, 0, 4421, 3}, {9887, 3, 0, 4424, 4}, {9890, 5, 0, 4428, 2},
+		{9895, 8, 0, 4430, 3}, {9903, 16, 0, 4433, 3}, {9919, 6, 0, 4436, 3}, {9925, 5, 0, 4439, 3},
+		{9930, 4, 0, 4442, 2}, {9934, 7, 0, 4444, 3}, {9941, 8, 0, 4447, 3}, {9949, 9, 0, 4450, 3},
+		{9958, 6, 0, 4453, 1}, {9964, 7, 0, 4454, 3}, {9971, 11, 0, 4457, 3}, {9982, 7, 0, 4460, 3},
+		{9989, 11, 0, 4463, 3}, {10000, 12, 0, 4466, 1}, {10012, 3, 0, 4467, 4}, {10015, 7, 0, 4471, 3},
+		{10022, 6, 0, 4474, 3}, {10028, 11, 0, 4477, 3}, {10039, 15, 0, 4480, 3}, {10054, 13, 0, 4483, 3},
+		{10067, 4, 0, 4486, 3}, {10071, 4, 0, 4489, 3}, {10075, 8, 0, 4492, 3}, {10083, 6, 0, 4495, 2},
+		{10089, 6, 0, 4497, 3}, {10095, 3, 0, 4500, 4}, {10098, 6, 0, 4504, 3}, {10104, 5, 0, 4507, 3},
+		{10109, 8, 0, 4510, 3}, {10117, 7, 0, 4513, 3}, {10124, 4, 0, 4516, 2}, {10128, 6, 0, 4518, 3},
+		{10134, 4, 0, 4521, 3}, {10138, 6, 0, 4524, 3}, {10144, 3, 0, 4527, 2}, {10147, 4, 0, 4529, 3},
+		{10151, 3, 0, 4532, 4}, {10154, 6, 0, 4536, 2}, {10160, 3, 0, 4538, 2}, {10163, 8, 0, 4540, 3},
+		{10171, 7, 0, 4543, 3}, {10178, 5, 0, 4546, 5}, {10183, 5, 0, 4551, 3}, {10188, 3, 0, 4554, 3},
+		{10191, 7, 0, 4557, 3}, {10198, 3, 0, 4560, 4}, {10201, 14, 0, 4564, 3}, {10215, 13, 0, 4567, 3},
+		{10228, 18, 0, 4570, 3}, {10246, 4, 0, 4573, 4}, {10250, 3, 0, 4577, 3}, {10253, 18, 0, 4580, 3},
+		{10271, 5, 0, 4583, 3}, {10276, 6, 0, 4586, 3}, {10282, 12, 0, 4589, 3}, {10294, 4, 0, 4592, 4},
+		{10298, 6, 0, 4596, 2}, {10304, 4, 0, 4598, 3}, {10308, 10, 0, 4601, 6}, {10318, 5, 0, 4607, 3},
+		{10323, 4, 0, 4610, 3}, {10327, 6, 0, 4613, 2}, {10333, 3, 0, 4615, 2}, {10336, 4, 0, 4617, 3},
+		{10340, 12, 0, 4620, 3}, {10352, 4, 0, 4623, 3}, {10356, 17, 0, 4626, 5}, {10373, 18, 0, 4631, 3},
+		{10391, 5, 0, 4634, 3}, {10396, 5, 0, 4637, 3}, {10401, 9, 0, 4640, 3}, {10410, 9, 0, 4643, 3},
+		{10419, 5, 0, 4646, 3}, {10424, 15, 0, 4649, 3}, {10439, 6, 0, 4652, 3}, {10445, 12, 0, 4655, 3},
+		{10457, 9, 0, 4658, 2}, {10466, 3, 0, 4660, 4}, {10469, 6, 1, 4664, 2}, {10475, 5, 0, 4666, 2},
+		{10480, 8, 0, 4668, 3}, {10488, 9, 0, 4671, 3}, {10497, 7, 0, 4674, 3}, {10504, 5, 0, 4677, 3},
+		{10509, 3, 0, 4680, 2}, {10512, 5, 0, 4682, 3}, {10517, 7, 0, 4685, 3}, {10524, 2, 0, 4688, 3},
+		{10526, 4, 0, 4691, 2}, {10530, 4, 0, 4693, 3}, {10534, 5, 0, 4696, 2}, {10539, 9, 0, 4698, 3},
+		{10548, 5, 0, 4701, 3}, {10553, 4, 0, 4704, 4}, {10557, 4, 0, 4708, 4}, {10561, 3, 0, 4712, 3},
+		{10564, 5, 0, 4715, 3}, {10569, 8, 0, 4718, 3}, {10577, 4, 0, 4721, 5}, {10581, 8, 0, 4726, 3},
+		{10589, 6, 0, 4729, 3}, {10595, 7, 0, 4732, 3}, {10602, 9, 0, 4735, 3}, {10611, 10, 0, 4738, 3},
+		{10621, 6, 0, 4741, 3}, {10627, 4, 0, 4744, 3}, {10631, 4, 0, 4747, 3}, {10635, 12, 0, 4750, 3},
+		{10647, 16, 0, 4753, 3}, {10663, 5, 0, 4756, 3}, {10668, 6, 0, 4759, 3}, {10674, 3, 0, 4762, 2},
+		{10677, 5, 0, 4764, 3}, {10682, 11, 0, 4767, 3}, {10693, 3, 0, 4770, 4}, {10696, 6, 0, 4774, 3},
+		{10702, 11, 0, 4777, 3}, {10713, 4, 0, 4780, 1}, {10717, 4, 0, 4781, 3}, {10721, 4, 0, 4784, 3},
+		{10725, 3, 0, 4787, 3}, {10728, 6, 0, 4790, 3}, {10734, 5, 0, 4793, 1}, {10739, 4, 0, 4794, 4},
+		{10743, 5, 0, 4798, 3}, {10748, 6, 0, 4801, 2}, {10754, 5, 0, 4803, 3}, {10759, 15, 0, 4806, 3},
+		{10774, 3, 0, 4809, 2}, {10777, 5, 0, 4811, 3}, {10782, 6, 0, 4814, 3}, {10788, 6, 0, 4817, 3},
+		{10794, 5, 0, 4820, 2}, {10799, 3, 0, 4822, 3}, {10802, 4, 0, 4825, 4}, {10806, 16, 0, 4829, 3},
+		{10822, 17, 0, 4832, 3}, {10839, 5, 0, 4835, 3}, {10844, 15, 0, 4838, 3}, {10859, 3, 0, 4841, 3},
+		{10862, 13, 0, 4844, 3}, {10875, 6, 0, 4847, 3}, {10881, 6, 1, 4850, 2}, {10887, 9, 0, 4852, 3},
+		{10896, 4, 0, 4855, 3}, {10900, 19, 0, 4858, 3}, {10919, 3, 0, 4861, 4}, {10922, 4, 0, 4865, 3},
+		{10926, 6, 0, 4868, 3}, {10932, 4, 0, 4871, 4}, {10936, 6, 0, 4875, 3}, {10942, 5, 0, 4878, 3},
+		{10947, 7, 0, 4881, 2}, {10954, 6, 0, 4883, 3}, {10960, 4, 0, 4886, 1}, {10964, 3, 0, 4887, 4},
+		{10967, 3, 0, 4891, 2}, {10970, 8, 0, 4893, 3}, {10978, 7, 0, 4896, 3}, {10985, 6, 0, 4899, 3},
+		{10991, 5, 0, 4902, 3}, {10996, 6, 0, 4905, 3}, {11002, 4, 0, 4908, 4}, {11006, 5, 0, 4912, 3},
+		{11011, 7, 0, 4915, 3}, {11018, 5, 0, 4918, 2}, {11023, 4, 0, 4920, 3}, {11027, 4, 0, 4923, 2},
+		{11031, 8, 0, 4925, 3}, {11039, 6, 0, 4928, 3}, {11045, 5, 0, 4931, 3}, {11050, 5, 0, 4934, 3},
+		{11055, 3, 0, 4937, 2}, {11058, 6, 0, 4939, 3}, {11064, 4, 0, 4942, 2}, {11068, 7, 0, 4944, 3},
+		{11075, 6, 0, 4947, 3}, {11081, 15, 0, 4950, 3}, {11096, 6, 0, 4953, 3}, {11102, 4, 0, 4956, 3},
+		{11106, 2, 0, 4959, 3}, {11108, 5, 0, 4962, 3}, {11113, 5, 0, 4965, 3}, {11118, 4, 0, 4968, 3},
+		{11122, 8, 0, 4971, 3}, {11130, 6, 0, 4974, 3}, {11136, 7, 0, 4977, 3}, {11143, 4, 0, 4980, 3},
+		{11147, 6, 0, 4983, 3}, {11153, 6, 0, 4986, 2}, {11159, 4, 0, 4988, 2}, {11163, 19, 0, 4990, 5},
+		{11182, 9, 0, 4995, 3}, {11191, 5, 0, 4998, 3}, {11196, 6, 1, 5001, 2}, {11202, 4, 0, 5003, 4},
+		{11206, 5, 0, 5007, 2}, {11211, 5, 0, 5009, 3}, {11216, 4, 0, 5012, 3}, {11220, 13, 0, 5015, 3},
+		{11233, 9, 0, 5018, 3}, {11242, 5, 0, 5021, 2}, {11247, 6, 0, 5023, 3}, {11253, 3, 0, 5026, 2},
+		{11256, 4, 0, 5028, 2}, {11260, 8, 0, 5030, 3}, {11268, 4, 0, 5033, 2}, {11272, 9, 0, 5035, 2},
+		{11281, 6, 0, 5037, 3}, {11287, 5, 0, 5040, 3}, {11292, 6, 0, 5043, 3}, {11298, 6, 0, 5046, 3},
+		{11304, 10, 0, 5049, 3}, {11314, 4, 0, 5052, 6}, {11318, 5, 0, 5058, 2}, {11323, 6, 0, 5060, 2},
+		{11329, 15, 0, 5062, 3}, {11344, 6, 0, 5065, 2}, {11350, 5, 0, 5067, 3}, {11355, 7, 0, 5070, 3},
+		{11362, 4, 0, 5073, 3}, {11366, 14, 0, 5076, 3}, {11380, 5, 0, 5079, 3}, {11385, 6, 0, 5082, 3},
+		{11391, 3, 0, 5085, 3}, {11394, 5, 0, 5088, 3}, {11399, 6, 1, 5091, 2}, {11405, 4, 0, 5093, 3},
+		{11409, 4, 0, 5096, 3}, {11413, 12, 0, 5099, 3}, {11425, 7, 0, 5102, 3}, {11432, 6, 0, 5105, 3},
+		{11438, 2, 1, 5108, 1}, {11440, 5, 0, 5109, 3}, {11445, 4, 0, 5112, 4}, {11449, 5, 0, 5116, 3},
+		{11454, 7, 0, 5119, 3}, {11461, 5, 0, 5122, 2}, {11466, 3, 0, 5124, 4}, {11469, 5, 0, 5128, 3},
+		{11474, 3, 0, 5131, 3}, {11477, 6, 0, 5134, 3}, {11483, 7, 0, 5137, 2}, {11490, 7, 0, 5139, 3},
+		{11497, 3, 0, 5142, 3}, {11500, 10, 0, 5145, 3}, {11510, 3, 0, 5148, 2}, {11513, 5, 0, 5150, 3},
+		{11518, 6, 0, 5153, 3}, {11524, 14, 0, 5156, 3}, {11538, 5, 0, 5159, 3}, {11543, 20, 0, 5162, 3},
+		{11563, 5, 0, 5165, 3}, {11568, 5, 0, 5168, 2}, {11573, 9, 0, 5170, 2}, {11582, 13, 0, 5172, 3},
+		{11595, 5, 0, 5175, 3}, {11600, 3, 0, 5178, 3}, {11603, 6, 0, 5181, 3}, {11609, 4, 0, 5184, 2},
+		{11613, 4, 0, 5186, 3}, {11617, 6, 0, 5189, 3}, {11623, 5, 0, 5192, 5}, {11628, 8, 0, 5197, 3},
+		{11636, 5, 0, 5200, 2}, {11641, 8, 0, 5202, 3}, {11649, 5, 0, 5205, 2}, {11654, 6, 0, 5207, 3},
+		{11660, 5, 0, 5210, 3}, {11665, 7, 0, 5213, 1}, {11672, 5, 0, 5214, 3}, {11677, 3, 0, 5217, 2},
+		{11680, 4, 0, 5219, 3}, {11684, 17, 0, 5222, 3}, {11701, 9, 0, 5225, 3}, {11710, 10, 0, 5228, 3},
+		{11720, 6, 0, 5231, 3}, {11726, 6, 0, 5234, 3}, {11732, 3, 0, 5237, 3}, {11735, 6, 1, 5240, 2},
+		{11741, 6, 0, 5242, 2}, {11747, 6, 0, 5244, 2}, {11753, 6, 0, 5246, 3}, {11759, 8, 0, 5249, 2},
+		{11767, 13, 0, 5251, 3}, {11780, 2, 0, 5254, 2}, {11782, 3, 0, 5256, 3}, {11785, 5, 0, 5259, 3},
+		{11790, 5, 0, 5262, 3}, {11795, 3, 0, 5265, 3}, {11798, 6, 0, 5268, 3}, {11804, 5, 0, 5271, 3},
+		{11809, 15, 0, 5274, 3}, {11824, 5, 0, 5277, 3}, {11829, 9, 0, 5280, 3}, {11838, 7, 0, 5283, 3},
+		{11845, 5, 1, 5286, 2}, {11850, 16, 0, 5288, 3}, {11866, 7, 0, 5291, 3}, {11873, 7, 0, 5294, 3},
+		{11880, 4, 0, 5297, 1}, {11884, 2, 0, 5298, 3}, {11886, 4, 1, 5301, 2}, {11890, 7, 0, 5303, 3},
+		{11897, 5, 0, 5306, 3}, {11902, 5, 0, 5309, 3}, {11907, 5, 0, 5312, 3}, {11912, 7, 0, 5315, 3},
+		{11919, 17, 0, 5318, 3}, {11936, 8, 0, 5321, 3}, {11944, 15, 0, 5324, 3}, {11959, 7, 0, 5327, 3},
+		{11966, 4, 0, 5330, 3}, {11970, 9, 0, 5333, 3}, {11979, 4, 1, 5336, 2}, {11983, 11, 0, 5338, 3},
+		{11994, 4, 0, 5341, 4}, {11998, 5, 0, 5345, 2}, {12003, 5, 0, 5347, 3}, {12008, 5, 1, 5350, 2},
+		{12013, 5, 0, 5352, 2}, {12018, 3, 0, 5354, 2}, {12021, 4, 0, 5356, 2}, {12025, 6, 0, 5358, 3},
+		{12031, 5, 0, 5361, 3}, {12036, 6, 0, 5364, 3}, {12042, 10, 0, 5367, 3}, {12052, 17, 0, 5370, 5},
+		{12069, 5, 0, 5375, 3}, {12074, 4, 0, 5378, 2}, {12078, 3, 0, 5380, 3}, {12081, 7, 0, 5383, 3},
+		{12088, 14, 0, 5386, 3}, {12102, 5, 0, 5389, 3}, {12107, 5, 0, 5392, 3}, {12112, 5, 0, 5395, 3},
+		{12117, 5, 0, 5398, 3}, {12122, 9, 0, 5401, 3}, {12131, 5, 0, 5404, 3}, {12136, 8, 0, 5407, 2},
+		{12144, 5, 0, 5409, 3}, {12149, 15, 0, 5412, 3}, {12164, 12, 0, 5415, 3}, {12176, 4, 0, 5418, 3},
+		{12180, 6, 0, 5421, 3}, {12186, 2, 0, 5424, 2}, {12188, 5, 0, 5426, 3}, {12193, 6, 0, 5429, 3},
+		{12199, 6, 1, 5432, 2}, {12205, 5, 0, 5434, 3}, {12210, 6, 0, 5437, 3}, {12216, 7, 0, 5440, 3},
+		{12223, 5, 0, 5443, 3}, {12228, 6, 0, 5446, 3}, {12234, 8, 0, 5449, 3}, {12242, 3, 0, 5452, 2},
+		{12245, 6, 0, 5454, 1}, {12251, 4, 0, 5455, 4}, {12255, 5, 0, 5459, 3}, {12260, 4, 1, 5462, 2},
+		{12264, 12, 0, 5464, 3}, {12276, 8, 0, 5467, 3}, {12284, 4, 0, 5470, 2}, {12288, 5, 0, 5472, 3},
+		{12293, 4, 0, 5475, 3}, {12297, 5, 0, 5478, 2}, {12302, 3, 0, 5480, 2}, {12305, 3, 0, 5482, 2},
+		{12308, 3, 0, 5484, 6}, {12311, 20, 0, 5490, 3}, {12331, 12, 0, 5493, 3}, {12343, 13, 0, 5496, 3},
+		{12356, 6, 0, 5499, 2}, {12362, 6, 0, 5501, 3}, {12368, 5, 0, 5504, 3}, {12373, 4, 0, 5507, 3},
+		{12377, 9, 0, 5510, 3}, {12386, 4, 0, 5513, 3}, {12390, 18, 0, 5516, 3}, {12408, 6, 0, 5519, 3},
+		{12414, 4, 0, 5522, 3}, {12418, 4, 0, 5525, 4}, {12422, 5, 1, 5529, 2}, {12427, 6, 0, 5531, 3},
+		{12433, 5, 0, 5534, 3}, {12438, 14, 0, 5537, 3}, {12452, 4, 0, 5540, 6}, {12456, 3, 0, 5546, 2},
+		{12459, 8, 0, 5548, 3}, {12467, 7, 0, 5551, 3}, {12474, 6, 0, 5554, 3}, {12480, 5, 0, 5557, 3},
+		{12485, 6, 0, 5560, 2}, {12491, 7, 0, 5562, 3}, {12498, 16, 0, 5565, 3}, {12514, 5, 0, 5568, 2},
+		{12519, 5, 0, 5570, 2}, {12524, 13, 0, 5572, 3}, {12537, 6, 0, 5575, 3}, {12543, 10, 0, 5578, 3},
+		{12553, 4, 0, 5581, 3}, {12557, 6, 0, 5584, 3}, {12563, 3, 0, 5587, 3}, {12566, 6, 0, 5590, 3},
+		{12572, 10, 0, 5593, 3}, {12582, 4, 0, 5596, 2}, {12586, 7, 0, 5598, 3}, {12593, 8, 0, 5601, 3},
+		{12601, 5, 0, 5604, 3}, {12606, 2, 1, 5607, 1}, {12608, 7, 0, 5608, 3}, {12615, 5, 0, 5611, 3},
+		{12620, 3, 0, 5614, 2}, {12623, 10, 0, 5616, 3}, {12633, 8, 0, 5619, 3}, {12641, 7, 0, 5622, 3},
+		{12648, 15, 0, 5625, 5}, {12663, 6, 0, 5630, 1}, {12669, 8, 0, 5631, 3}, {12677, 14, 0, 5634, 3},
+		{12691, 4, 0, 5637, 3}, {12695, 6, 0, 5640, 3}, {12701, 5, 0, 5643, 2}, {12706, 7, 0, 5645, 6},
+		{12713, 4, 0, 5651, 3}, {12717, 4, 0, 5654, 3}, {12721, 5, 0, 5657, 3}, {12726, 8, 0, 5660, 3},
+		{12734, 8, 0, 5663, 3}, {12742, 5, 0, 5666, 3}, {12747, 4, 0, 5669, 3}, {12751, 4, 0, 5672, 3},
+		{12755, 4, 0, 5675, 4}, {12759, 5, 0, 5679, 3}, {12764, 5, 0, 5682, 3}, {12769, 3, 0, 5685, 2},
+		{12772, 11, 0, 5687, 3}, {12783, 3, 0, 5690, 2}, {12786, 14, 0, 5692, 3}, {12800, 5, 0, 5695, 3},
+		{12805, 3, 0, 5698, 3}, {12808, 11, 0, 5701, 3}, {12819, 6, 0, 5704, 2}, {12825, 4, 0, 5706, 2},
+		{12829, 6, 0, 5708, 2}, {12835, 6, 0, 5710, 3}, {12841, 10, 0, 5713, 5}, {12851, 7, 0, 5718, 3},
+		{12858, 5, 0, 5721, 3}, {12863, 4, 0, 5724, 2}, {12867, 7, 0, 5726, 3}, {12874, 7, 0, 5729, 2},
+		{12881, 4, 0, 5731, 3}, {12885, 13, 0, 5734, 3}, {12898, 7, 0, 5737, 3}, {12905, 11, 0, 5740, 3},
+		{12916, 11, 0, 5743, 3}, {12927, 5, 0, 5746, 3}, {12932, 4, 0, 5749, 3}, {12936, 6, 0, 5752, 2},
+		{12942, 6, 0, 5754, 3}, {12948, 14, 0, 5757, 3}, {12962, 3, 0, 5760, 2}, {12965, 4, 0, 5762, 2},
+		{12969, 4, 0, 5764, 2}, {12973, 6, 0, 5766, 2}, {12979, 21, 0, 5768, 3}, {13000, 6, 1, 5771, 2},
+		{13006, 4, 0, 5773, 4}, {13010, 6, 0, 5777, 3}, {13016, 6, 0, 5780, 2}, {13022, 3, 0, 5782, 2},
+		{13025, 4, 0, 5784, 2}, {13029, 3, 0, 5786, 1}, {13032, 21, 0, 5787, 3}, {13053, 6, 0, 5790, 2},
+		{13059, 6, 0, 5792, 2}, {13065, 7, 0, 5794, 3}, {13072, 5, 0, 5797, 3}, {13077, 10, 0, 5800, 3},
+		{13087, 4, 0, 5803, 4}, {13091, 6, 0, 5807, 2}, {13097, 13, 0, 5809, 3}, {13110, 3, 0, 5812, 4},
+		{13113, 4, 0, 5816, 3}, {13117, 5, 0, 5819, 3}, {13122, 6, 0, 5822, 3}, {13128, 6, 0, 5825, 3},
+		{13134, 9, 0, 5828, 6}, {13143, 15, 0, 5834, 3}, {13158, 8, 0, 5837, 3}, {13166, 10, 0, 5840, 3},
+		{13176, 3, 0, 5843, 3}, {13179, 13, 0, 5846, 3}, {13192, 2, 0, 5849, 3}, {13194, 6, 0, 5852, 3},
+		{13200, 4, 0, 5855, 3}, {13204, 4, 0, 5858, 3}, {13208, 4, 0, 5861, 5}, {13212, 2, 0, 5866, 3},
+		{13214, 13, 0, 5869, 3}, {13227, 3, 0, 5872, 3}, {13230, 6, 0, 5875, 3}, {13236, 3, 0, 5878, 2},
+		{13239, 4, 0, 5880, 4}, {13243, 6, 0, 5884, 3}, {13249, 6, 1, 5887, 2}, {13255, 12, 0, 5889, 3},
+		{13267, 15, 0, 5892, 3}, {13282, 11, 0, 5895, 3}, {13293, 5, 0, 5898, 3}, {13298, 4, 0, 5901, 2},
+		{13302, 6, 0, 5903, 2}, {13308, 5, 0, 5905, 3}, {13313, 4, 0, 5908, 3}, {13317, 6, 0, 5911, 3},
+		{13323, 5, 1, 5914, 2}, {13328, 3, 0, 5916, 6}, {13331, 3, 0, 5922, 3}, {13334, 10, 0, 5925, 3},
+		{13344, 6, 0, 5928, 3}, {13350, 7, 0, 5931, 3}, {13357, 5, 0, 5934, 3}, {13362, 4, 0, 5937, 3},
+		{13366, 3, 1, 5940, 2}, {13369, 6, 0, 5942, 3}, {13375, 6, 0, 5945, 3}, {13381, 13, 0, 5948, 3},
+		{13394, 4, 0, 5951, 4}, {13398, 12, 0, 5955, 3}, {13410, 3, 0, 5958, 3}, {13413, 5, 0, 5961, 3},
+		{13418, 12, 0, 5964, 3}, {13430, 6, 0, 5967, 3}, {13436, 2, 0, 5970, 3}, {13438, 16, 0, 5973, 3},
+		{13454, 3, 0, 5976, 2}, {13457, 4, 0, 5978, 3}, {13461, 6, 0, 5981, 3}, {13467, 4, 0, 5984, 3},
+		{13471, 6, 0, 5987, 3}, {13477, 3, 0, 5990, 3}, {13480, 4, 0, 5993, 4}, {13484, 3, 0, 5997, 3},
+		{13487, 5, 0, 6000, 3}, {13492, 10, 0, 6003, 2}, {13502, 5, 0, 6005, 3}, {13507, 14, 0, 6008, 3},
+		{13521, 5, 0, 6011, 3}, {13526, 4, 0, 6014, 4}, {13530, 17, 0, 6018, 3}, {13547, 7, 0, 6021, 3},
+		{13554, 5, 0, 6024, 2}, {13559, 5, 0, 6026, 2}, {13564, 15, 0, 6028, 3}, {13579, 6, 0, 6031, 3},
+		{13585, 10, 0, 6034, 3}, {13595, 5, 0, 6037, 3}, {13600, 6, 0, 6040, 2}, {13606, 5, 0, 6042, 2},
+		{13611, 5, 0, 6044, 2}, {13616, 2, 0, 6046, 3}, {13618, 4, 0, 6049, 2}, {13622, 5, 0, 6051, 3},
+		{13627, 8, 0, 6054, 3}, {13635, 15, 0, 6057, 3}, {13650, 5, 0, 6060, 3}, {13655, 8, 0, 6063, 3},
+		{13663, 5, 1, 6066, 2}, {13668, 13, 0, 6068, 3}, {13681, 7, 0, 6071, 3}, {13688, 4, 0, 6074, 3},
+		{13692, 3, 0, 6077, 3}, {13695, 6, 0, 6080, 2}, {13701, 4, 0, 6082, 3}, {13705, 10, 0, 6085, 3},
+		{13715, 6, 0, 6088, 1}, {13721, 3, 0, 6089, 4}, {13724, 6, 0, 6093, 3}, {13730, 3, 0, 6096, 3},
+		{13733, 9, 0, 6099, 3}, {13742, 5, 0, 6102, 3}, {13747, 5, 0, 6105, 2}, {13752, 6, 0, 6107, 3},
+		{13758, 6, 0, 6110, 2}, {13764, 12, 0, 6112, 3}, {13776, 17, 0, 6115, 3}, {13793, 2, 0, 6118, 3},
+		{13795, 5, 0, 6121, 6}, {13800, 6, 0, 6127, 3}, {13806, 7, 0, 6130, 3}, {13813, 3, 0, 6133, 2},
+		{13816, 5, 0, 6135, 3}, {13821, 5, 0, 6138, 3}, {13826, 6, 0, 6141, 3}, {13832, 4, 0, 6144, 1},
+		{13836, 4, 0, 6145, 2}, {13840, 5, 1, 6147, 2}, {13845, 18, 0, 6149, 3}, {13863, 4, 0, 6152, 3},
+		{13867, 5, 1, 6155, 2}, {13872, 6, 0, 6157, 3}, {13878, 3, 1, 6160, 2}, {13881, 6, 1, 6162, 2},
+		{13887, 6, 1, 6164, 2}, {13893, 7, 0, 6166, 2}, {13900, 5, 0, 6168, 3}, {13905, 16, 0, 6171, 3},
+		{13921, 3, 0, 6174, 3}, {13924, 8, 0, 6177, 3}, {13932, 8, 0, 6180, 3}, {13940, 7, 0, 6183, 3},
+		{13947, 4, 0, 6186, 3}, {13951, 6, 0, 6189, 3}, {13957, 4, 0, 6192, 3}, {13961, 6, 0, 6195, 3},
+		{13967, 3, 0, 6198, 5}, {13970, 12, 0, 6203, 3}, {13982, 8, 0, 6206, 3}, {13990, 6, 0, 6209, 3},
+		{13996, 8, 0, 6212, 3},
+	};
+	// Seeds of buckets, or slots of buckets with one name as -slot - 1.
+	const int16_t DISPLACEMENTS[REFERENCE_COUNT] = {
+		0, 1, -2114, 1, 1, -2111, 0, 2, 0, 0, 3, 0, 1, -2110, -2109, -2100,
+		0, 1, 0, 1, 0, 0, 0, 0, 1, -2098, 0, 1, 1, 0, 1, 1,
+		-2095, -2093, -2092, 1, -2091, 2, -2087, -2086, 4, -2084, 0, 1, 0, 2, -2081, -2080,
+		0, -2079, 0, 3, 0, -2076, 0, 0, 0, 3, 1, 0, 2, -2069, -2064, -2058,
+		5, 0, -2056, 0, -2054, -2053, 0, -2050, -2049, -2048, 0, 1, 0, -2046, 0, 3,
+		0, 0, -2045, 0, -2042, 0, -2041, -2039, 0, 0, 0, 0, 0, 0, -2034, -2030,
+		-2022, 1, -2017, 1, -2011, 0, -2007, 1, 0, -2004, 0, -1999, 0, 0, 0, 0,
+		0, 2, -1998, -1990, -1985, 2, -1984, -1981, 1, 1, -1976, 0, 1, 0, -1973, 1,
+		1, 0, -1968, -1966, 0, 0, -1964, 1, 1, 1, 0, 0, -1960, -1958, -1955, 0,
+		-1949, 0, -1944, 1, -1939, 0, -1937, 1, 0, -1935, 2, 1, 0, 5, 4, -1934,
+		0, -1933, 0, 2, 0, -1924, 2, 0, 0, 0, 1, -1919, 0, -1916, 0, -1913,
+		0, 0, 0, 0, 3, 1, 0, 4, -1911, -1908, -1906, 3, 2, 0, 1, -1903,
+		-1901, 0, -1900, 0, -1898, 0, 1, 2, 1, -1895, 1, 1, 1, -1887, -1886, 1,
+		-1885, 2, -1882, -1880, 1, 0, 1, -1878, 1, 0, 0, 0, 0, 3, 0, -1876,
+		0, 0, 1, -1875, 1, 0, -1869, 0, 6, -1868, 1, 1, 0, 3, 0, 0,
+		0, 2, -1866, 2, 0, 1, -1861, 1, -1859, -1858, 1, 1, -1850, -1849, 1, 0,
+		0, -1838, 0, -1835, 0, -1826, 1, 0, 1, -1824, 0, -1822, -1821, 0, 3, 0,
+		0, 0, 1, 1, -1816, -1804, 0, -1803, 2, 2, 1, 1, 0, 6, 5, 1,
+		0, -1799, -1797, 1, 2, 0, -1793, -1792, 1, 0, 0, -1790, 0, 0, 0, 1,
+		-1789, -1786, 0, 0, -1784, 2, 0, -1780, -1778, 0, -1775, 0, 1, -1773, 0, 2,
+		0, 0, 1, 0, -1772, -1767, -1766, 0, -1765, 0, 1, -1756, 1, 0, 0, 0,
+		1, 0, 0, 1, -1754, 1, 1, -1751, -1746, -1745, 0, 0, 0, 0, 2, 0,
+		0, -1742, 0, 2, 2, -1738, 0, 3, -1735, 0, 2, 0, 1, 4, 0, 0,
+		-1734, 1, -1732, -1728, 1, 0, -1723, 0, 0, -1721, -1719, 0, 1, 0, -1714, 1,
+		-1712, 0, 1, -1711, -1708, 0, 0, -1707, -1705, 2, -1703, -1699, -1698, 0, 2, -1697,
+		0, 0, 0, 0, 0, 0, 1, 0, -1695, -1693, 0, 0, 0, 2, -1692, -1687,
+		3, -1686, 1, -1685, 0, -1684, 0, -1683, -1682, 0, 0, -1679, 0, 0, -1677, -1676,
+		0, 0, 2, 0, 1, -1673, -1671, 0, -1669, 0, 1, 0, 0, 3, -1660, 1,
+		-1659, 5, 0, -1658, 1, 0, -1656, 1, 0, -1654, 0, 1, 0, 1, -1644, 0,
+		1, -1640, 0, 0, 5, 0, 0, -1639, 0, -1635, 0, -1634, 0, 0, 1, -1633,
+		2, 0, -1629, 4, -1628, 0, -1621, 3, 2, -1619, 0, -1617, 0, 0, -1615, 2,
+		2, -1609, -1601, 1, 0, 1, -1599, 0, -1597, 0, -1589, -1583, 2, 0, -1581, -1580,
+		-1576, 1, 7, 0, -1572, -1571, 0, -1570, -1568, -1566, 0, -1562, -1560, 0, 0, 0,
+		6, 2, 5, -1558, 0, 1, 0, -1556, 2, 0, 1, 0, 0, -1553, -1551, -1550,
+		-1549, 0, -1548, -1547, 0, 1, -1544, -1542, -1540, 1, 1, -1535, -1531, -1527, 0, 1,
+		-1526, -1524, -1523, 0, -1521, 0, -1519, -1513, 1, -1508, 2, 1, 0, 0, 0, -1505,
+		0, 0, 1, -1504, -1502, 0, 0, -1499, -1498, 0, 4, 0, -1494, 0, 0, 0,
+		0, 2, 2, 0, -1488, 4, 1, 1, 0, 0, 2, 0, 0, 0, 0, 0,
+		0, -1487, -1485, 0, 2, 0, 2, 14, 4, -1484, 1, -1483, -1480, 0, 3, 0,
+		-1479, -1473, 0, 7, 0, -1472, 3, 1, 0, -1470, 0, 0, -1463, 3, 0, -1460,
+		-1458, -1456, 11, 2, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 1, -1451,
+		0, 0, -1448, 3, 0, 1, -1446, 0, -1445, 0, 0, 5, -1443, 1, 0, 0,
+		0, 1, -1440, -1439, -1438, -1435, 0, 1, -1432, 0, 1, 0, 8, 1, 1, -1430,
+		2, -1429, 0, 0, -1428, 1, 3, 0, 1, -1426, 0, 1, -1423, 0, 1, -1421,
+		0, -1419, 0, 0, 1, 4, -1418, 0, 2, -1417, 0, -1414, 4, 0, 0, 0,
+		-1412, 0, 0, -1410, 1, 10, 0, -1407, 2, -1404, 0, -1403, 0, -1401, 1, 3,
+		1, 0, 0, 0, -1399, 0, -1398, 2, 0, 1, 0, -1397, -1396, 0, -1391, -1387,
+		-1386, -1385, 1, -1384, -1382, 0, -1378, -1377, 1, 1, 1, 1, 0, -1372, 0, 0,
+		3, -1371, 0, -1370, 0, 0, 0, 1, -1364, -1359, -1358, 0, -1356, 0, 0, -1354,
+		0, 2, 1, 3, -1351, 0, -1348, -1345, -1343, -1334, 3, -1329, -1327, 0, -1324, 0,
+		0, -1318, -1317, 1, 0, -1315, 0, 5, -1311, 2, -1306, -1305, -1304, 9, -1297, 2,
+		2, 0, 0, -1296, 0, -1295, 10, -1293, -1289, 1, 3, 0, -1286, 2, -1283, 1,
+		0, -1282, 0, 10, 2, 0, -1281, -1276, 1, 5, -1274, -1272, 0, 2, 0, -1270,
+		0, 1, -1265, 2, 2, -1261, -1259, -1258, 0, -1257, -1254, -1250, 3, -1249, -1246, -1244,
+		-1240, -1239, -1238, 0, -1237, -1236, 2, 1, 0, -1235, 8, 0, 3, -1234, -1231, -1224,
+		0, -1219, 9, 6, -1215, 1, 0, -1213, 1, 5, 0, -1212, -1211, 0, 0, 1,
+		0, -1210, 0, -1207, 0, -1206, 0, 2, 0, 1, 0, -1199, 1, 1, -1192, 1,
+		0, 0, -1188, -1187, 8, -1185, -1182, 5, -1181, 0, 1, -1179, 1, -1177, 0, 7,
+		5, 1, 0, -1174, 0, 1, 0, -1168, 1, 1, 0, 0, 5, 1, 0, 0,
+		0, 0, 0, -1166, 0, 1, 0, -1165, -1161, -1159, 5, -1157, 1, -1156, -1155, 2,
+		0, -1154, -1151, -1147, -1146, 2, -1143, 0, 12, -1142, 0, -1141, -1140, 1, 1, -1139,
+		-1136, -1135, -1133, -1132, 1, 2, 0, -1129, 0, -1128, 3, -1127, 1, 2, -1123, 0,
+		0, -1122, 0, -1117, 0, -1112, 0, 0, 0, 0, 1, 0, 4, -1104, -1103, -1102,
+		6, 0, -1100, -1099, 0, 2, 2, -1098, 0, 0, 2, 0, 0, 0, 1, 3,
+		-1097, 0, 1, 2, 0, -1094, 1, 0, -1091, -1089, 0, -1085, 3, -1084, -1081, 0,
+		-1075, -1073, 0, 0, 0, 2, -1071, 3, -1070, 1, 0, -1068, -1067, 1, 0, 3,
+		3, -1063, 0, 1, 7, 0, -1062, -1057, -1055, -1052, 0, 0, -1046, 2, -1043, 3,
+		0, -1041, 1, 0, 11, 0, -1040, 3, 0, -1037, -1034, -1030, -1028, -1026, 0, 0,
+		1, 1, 4, 0, 0, 0, -1025, 0, 0, 3, 10, 3, 0, -1023, 0, 1,
+		-1021, 5, 0, 1, 0, 1, -1015, -1014, -1011, -1008, -1003, 1, -1002, 1, -999, 3,
+		2, 0, 0, 1, 1, -993, 3, -987, 1, 0, -985, 0, 2, -983, 0, 2,
+		2, 0, 0, -982, -980, 0, 2, -979, 0, 5, 0, 6, -975, 10, 3, -974,
+		-973, 0, 0, -968, 0, -965, -964, 12, -960, -959, -957, 0, 0, 0, -953, -952,
+		-951, 1, 0, 0, -949, -948, -946, 0, -945, 0, -944, 0, -942, 0, 0, 4,
+		8, -940, 1, 0, -939, 0, 1, -937, 1, 4, 5, 0, 0, -936, 0, 0,
+		-933, 0, 0, 1, 1, -932, -931, -930, -924, 4, -922, 0, 0, 0, -921, 0,
+		-919, 4, -917, -914, 2, -906, 5, -903, -902, 0, 1, -901, -898, 1, 0, 0,
+		-897, 0, -896, -894, -891, -890, -884, -883, 0, 11, 0, -882, 0, -881, 0, -878,
+		1, 0, 13, 0, -877, 1, -876, 3, 0, -873, -872, -871, 2, -870, 0, 0,
+		0, 1, -868, -861, 1, 0, -860, -859, 0, 0, 0, -856, -854, 0, 0, 0,
+		-852, 0, 0, -847, 0, -846, 2, -844, -840, 1, -838, -834, 2, 0, 0, 0,
+		-831, 0, -829, 0, 0, 1, -828, -824, 3, -823, 0, -821, -820, 0, 2, -809,
+		-807, -806, -804, 1, 1, 0, -801, 10, 1, 0, -798, 3, -784, 0, 0, 0,
+		-783, 0, -781, -779, 0, 0, 0, 3, 3, 3, 4, 0, -776, -775, 0, 2,
+		-774, -773, 1, 0, 2, -771, -770, 0, -761, -760, 0, -759, 0, 0, 0, -758,
+		-753, 0, 0, -751, -750, 2, 0, -749, -747, -744, 0, -743, -739, 0, 0, -737,
+		0, -736, -734, 0, -724, -723, 0, -719, 0, 0, 2, -712, 1, 3, 3, -711,
+		-710, 1, 0, 9, -702, 1, 0, 1, 1, 0, -696, 0, -692, -690, -687, 1,
+		0, -684, 14, -682, -681, -680, -678, 0, 1, -675, 0, 2, 2, 4, 0, 1,
+		-674, 0, 0, 0, 0, -673, 0, 16, -669, -667, 0, -666, 3, -664, 0, 0,
+		10, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 0,
+		-661, 0, -657, 0, 18, 0, -656, 0, 0, -655, -653, 0, 2, -652, -651, 0,
+		5, -649, -644, 3, 7, 0, -643, 0, 0, -642, -641, 0, 0, 0, 0, 0,
+		0, 0, 3, -640, 5, 0, 0, 2, 0, 0, 1, 0, 0, 0, 9, 0,
+		2, 0, 1, 2, 0, -639, -636, 0, -633, 0, 4, 7, -632, 0, -629, -628,
+		0, 2, 0, -627, 26, -624, 0, 2, -622, 9, 0, 0, 0, 0, -621, 0,
+		1, 5, 16, 0, 17, 5, 1, -617, -615, 0, -613, -612, 0, 0, -610, -605,
+		-604, 0, 4, -602, 0, 0, 1, -597, -592, 0, 1, -591, 1, -590, 0, 0,
+		0, -586, -585, 1, -584, -583, 0, -582, 0, 0, -581, 4, -572, 1, -571, 0,
+		-569, 0, -564, 0, 1, -563, -562, 1, 0, 0, -561, -558, 14, 1, 1, 1,
+		-557, -556, 2, 0, 0, 0, 0, -555, -549, 0, -548, -546, 0, -543, -542, 2,
+		0, 1, -541, 0, -540, 2, 7, -539, 0, -536, -533, -532, 0, 0, 1, 0,
+		0, -531, 6, -530, -527, -524, 1, 0, -522, 0, 0, 1, -521, 0, -518, 1,
+		-517, 0, 0, 0, 2, 0, 0, -516, -514, 0, -513, 0, 3, -510, 0, -508,
+		0, -501, 30, 0, -495, 1, 0, 0, 0, -494, 13, 1, 6, 1, 0, 4,
+		0, -492, -489, 0, -486, 3, -483, -482, -481, 0, 0, -479, 0, 0, 0, 1,
+		0, -477, 2, 0, 1, 1, -476, 5, -475, 8, -474, 4, 0, 5, -473, 0,
+		0, 0, 5, -469, 0, -462, 3, 1, 0, 1, -461, 0, 0, 3, -456, 0,
+		3, 0, 0, 3, 0, -454, 10, 0, 1, -451, -449, -441, -440, -432, -430, 0,
+		9, 0, -428, -423, 0, 6, 0, 0, -416, -415, 0, -413, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, -408, -406, 0, 10, 0, -403, -400, 2, 5,
+		0, 0, 3, -398, 0, 1, -391, -389, -388, -386, 0, 1, -380, -378, -377, 1,
+		-375, -372, 1, 0, 0, 0, 0, 0, 0, 1, -371, 22, 0, 0, -359, 0,
+		-355, 0, -352, 0, 0, 0, 14, -350, 0, 0, -349, -348, 0, 0, 0, -344,
+		0, -343, 0, 0, 0, -341, 0, -340, 0, -339, 2, -338, -337, 0, 0, 0,
+		3, -336, -334, 0, 0, 0, 0, -331, 8, 6, -329, -325, 0, 0, -316, 4,
+		12, 2, -315, 2, 4, 1, 1, 0, -312, 0, 0, 3, -307, 0, 7, -303,
+		-301, 0, 0, 0, -298, -297, 10, 0, 0, -295, -289, 0, 2, 0, 0, 0,
+		-285, -284, 5, -281, -280, -277, -275, -274, 1, 2, 0, 1, -270, 2, -259, 0,
+		-258, -257, 0, 4, 10, 2, 6, 0, 0, -254, -252, -251, -249, 8, -245, -235,
+		-234, 0, 5, -233, -225, 14, 0, 0, 0, 6, -224, -220, 0, -219, -218, -216,
+		0, -214, 0, -212, 5, 5, -206, -204, 1, 2, -203, 3, 2, -201, -198, 0,
+		0, 0, -192, -190, 0, 0, 0, -188, -187, -183, 1, -175, -172, 14, 3, 7,
+		7, 0, 0, 3, 0, -170, -166, 0, -162, 0, 1, 0, 2, 0, -161, 0,
+		5, -156, 0, -154, 0, -149, 2, 0, -143, 0, -142, -141, -140, -138, 0, 2,
+		30, 0, 0, -137, 0, -134, 0, 9, 14, -133, -132, 24, -126, 0, 3, 0,
+		-122, -120, -116, 5, 0, 0, -115, 4, 0, 0, -111, -110, -109, 0, 21, 0,
+		-105, -102, 1, -101, 3, 0, -95, 9, -94, -93, -91, 19, -89, 0, 56, 5,
+		-87, 0, 0, 0, 3, 17, 0, -85, 6, -78, -73, -71, 0, 0, 0, -70,
+		0, -64, -62, -60, -56, -54, -50, 81, 0, 9, -48, 0, 1, -46, -42, 0,
+		0, 10, -41, -40, -38, -33, 0, 0, -32, -26, 5, 0, -22, -19, 0, 1,
+		-15, 0, 5, 6, -13, -12, -11, -9, 0, 3, 0, 0, 9, 5, 0, 3,
+		1, 0, 0, 1, 0, -7, -6, 5, 0, 0, -2, -1, 0,
+	};
+}
+
+static uint32_t hash_name(const char * name, size_t size, uint32_t seed)
+{
+	uint32_t hash = 2166136261u ^ seed;
+	for(size_t i = 0; i < size; ++i) {
+		hash = (hash ^ uint8_t(name[i])) * 16777619u;
+	}
+	hash ^= hash >> 15;
+	hash *= 0x2c1b3c6du;
+	hash ^= hash >> 12;
+	return hash;
+}
+
+bool find_named_reference(const StringView & name, StringView & value, bool & legacy)
+{
+	if(name.empty() || name.size() > MAX_NAMED_REFERENCE_SIZE) {
+		return false;
+	}
+	int displacement = DISPLACEMENTS[hash_name(name.data(), name.size(), 0) % REFERENCE_COUNT];
+	size_t slot = displacement < 0 ? size_t(-displacement - 1)
+		: hash_name(name.data(), name.size(), uint32_t(displacement)) % REFERENCE_COUNT;
+	const Entry & entry = ENTRIES[slot];
+	if(entry.name_size != name.size() || memcmp(NAMES + entry.name_offset, name.data(), name.size()) != 0) {
+		return false;
+	}
+	value = StringView(VALUES + entry.value_offset, entry.value_size);
+	legacy = entry.legacy != 0;
+	return true;
+}
+
+}
@@ -0,0 +1,14 @@
+#pragma once
+#include "string_view.h"
+
+namespace Html2Mark {
+
+// Longest name of a named character reference, without '&' and ';'.
+const size_t MAX_NAMED_REFERENCE_SIZE = 31;
+
+// Looks up a name of the HTML5 named character references, given without
+// '&' and ';'. The value is UTF-8 and points to a static table.
+// Legacy names are recognized also without the semicolon, e.g. "&copy".
+bool find_named_reference(const StringView & name, StringView & value, bool & legacy);
+
+}
@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+# Generates named_references.cpp: the table of HTML5 named character
+# references (https://html.spec.whatwg.org/entities.json, as shipped
+# in html.entities of Python) with a perfect hash over the names.
+# Usage: python3 named_references.py > named_references.cpp
+from html.entities import html5
+
+# Converted text has no use for non-breaking spaces,
+# they are written as plain ones.
+OVERRIDES = {'nbsp': ' '}
+
+
+def name_hash(name, seed):
+	"""FNV-1a with seed and final mix, the same as hash_name() in the output."""
+	h = (2166136261 ^ seed) & 0xffffffff
+	for byte in name.encode():
+		h = ((h ^ byte) * 16777619) & 0xffffffff
+	h ^= h >> 15
+	h = (h * 0x2c1b3c6d) & 0xffffffff
+	h ^= h >> 12
+	return h
+
+
+def perfect_hash(names):
+	"""Hash and displace: names of every bucket get a seed that puts them
+	into free slots; buckets of one name point to a free slot directly."""
+	count = len(names)
+	buckets = [[] for _ in range(count)]
+	for name in names:
+		buckets[name_hash(name, 0) % count].append(name)
+	slots = [None] * count
+	displacements = [0] * count
+	for bucket in sorted(range(count), key=lambda b: -len(buckets[b])):
+		if len(buckets[bucket]) <= 1:
+			break
+		seed = 1
+		while True:
+			positions = [name_hash(name, seed) % count for name in buckets[bucket]]
+			if len(set(positions)) == len(positions) and all(slots[p] is None for p in positions):
+				break
+			seed += 1
+		for name, position in zip(buckets[bucket], positions):
+			slots[position] = name
+		displacements[bucket] = seed
+	free = [position for position in range(count) if slots[position] is None]
+	for bucket in range(count):
+		if len(buckets[bucket]) == 1:
+			position = free.pop()
+			slots[position] = buckets[bucket][0]
+			displacements[bucket] = -position - 1
+	return slots, displacements
+
+
+def c_string(data):
+	return '"' + ''.join(c if c.isalnum() else '\\x%02x' % ord(c) for c in data) + '"'
+
+
+def c_bytes(data):
+	return '"' + ''.join('\\x%02x' % b for b in data) + '"'
+
+
+def main():
+	names = sorted(name[:-1] for name in html5 if name.endswith(';'))
+	legacy = set(name for name in html5 if not name.endswith(';'))
+	slots, displacements = perfect_hash(names)
+	assert max(abs(d) for d in displacements) < 1 << 15
+
+	name_data = ''
+	value_data = b''
+	entries = []
+	for name in slots:
+		value = OVERRIDES.get(name, html5[name + ';']).encode()
+		entries.append((len(name_data), len(name), len(value_data), len(value), name in legacy))
+		name_data += name
+		value_data += value
+
+	print('// Generated by named_references.py, do not edit.')
+	print('#include "named_references.h"')
+	print('#include <cstdint>')
+	print('#include <cstring>')
+	print()
+	print('namespace Html2Mark {')
+	print()
+	print('namespace {')
+	print('\tconst size_t REFERENCE_COUNT = %d;' % len(names))
+	print('\tconst char NAMES[] =')
+	for start in range(0, len(name_data), 100):
+		print('\t\t' + c_string(name_data[start:start + 100]))
+	print('\t\t;')
+	print('\tconst char VALUES[] =')
+	for start in range(0, len(value_data), 24):
+		print('\t\t' + c_bytes(value_data[start:start + 24]))
+	print('\t\t;')
+	print('\tstruct Entry {')
+	print('\t\tuint16_t name_offset;')
+	print('\t\tuint8_t name_size;')
+	print('\t\tuint8_t legacy; // Also recognized without the semicolon.')
+	print('\t\tuint16_t value_offset;')
+	print('\t\tuint16_t value_size;')
+	print('\t};')
+	print('\t// Indexed by slots of the perfect hash.')
+	print('\tconst Entry ENTRIES[REFERENCE_COUNT] = {')
+	for start in range(0, len(entries), 4):
+		print('\t\t' + ' '.join('{%d, %d, %d, %d, %d},' % (e[0], e[1], int(e[4]), e[2], e[3])
+			for e in entries[start:start + 4]))
+	print('\t};')
+	print('\t// Seeds of buckets, or slots of buckets with one name as -slot - 1.')
+	print('\tconst int16_t DISPLACEMENTS[REFERENCE_COUNT] = {')
+	for start in range(0, len(displacements), 16):
+		print('\t\t' + ' '.join('%d,' % d for d in displacements[start:start + 16]))
+	print('\t};')
+	print('}')
+	print('''
+static uint32_t hash_name(const char * name, size_t size, uint32_t seed)
+{
+	uint32_t hash = 2166136261u ^ seed;
+	for(size_t i = 0; i < size; ++i) {
+		hash = (hash ^ uint8_t(name[i])) * 16777619u;
+	}
+	hash ^= hash >> 15;
+	hash *= 0x2c1b3c6du;
+	hash ^= hash >> 12;
+	return hash;
+}
+
+bool find_named_reference(const StringView & name, StringView & value, bool & legacy)
+{
+	if(name.empty() || name.size() > MAX_NAMED_REFERENCE_SIZE) {
+		return false;
+	}
+	int displacement = DISPLACEMENTS[hash_name(name.data(), name.size(), 0) % REFERENCE_COUNT];
+	size_t slot = displacement < 0 ? size_t(-displacement - 1)
+		: hash_name(name.data(), name.size(), uint32_t(displacement)) % REFERENCE_COUNT;
+	const Entry & entry = ENTRIES[slot];
+	if(entry.name_size != name.size() || memcmp(NAMES + entry.name_offset, name.data(), name.size()) != 0) {
+		return false;
+	}
+	value = StringView(VALUES + entry.value_offset, entry.value_size);
+	legacy = entry.legacy != 0;
+	return true;
+}
+
+}''')
+
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,113 @@
+#include "protocol.h"
+#include "io.h"
+#include <unistd.h>
+#include <cerrno>
+
+namespace Html2Mark {
+
+static void put_number(unsigned char * out, uint32_t value)
+{
+	out[0] = static_cast<unsigned char>(value >> 24);
+	out[1] = static_cast<unsigned char>(value >> 16);
+	out[2] = static_cast<unsigned char>(value >> 8);
+	out[3] = static_cast<unsigned char>(value);
+}
+
+static uint32_t get_number(const unsigned char * in)
+{
+	return uint32_t(in[0]) << 24 | uint32_t(in[1]) << 16 | uint32_t(in[2]) << 8 | uint32_t(in[3]);
+}
+
+static bool read_all(int fd, char * data, size_t size, const Deadline * deadline)
+{
+	while(size > 0) {
+		ssize_t count = read(fd, data, size);
+		if(count < 0 && errno == EINTR) {
+			continue;
+		}
+		if(count < 0 && errno == EAGAIN) {
+			if(!wait_for_file(fd, false, deadline)) {
+				return false;
+			}
+			continue;
+		}
+		if(count <= 0) {
+			return false;
+		}
+		data += count;
+		size -= size_t(count);
+	}
+	return true;
+}
+
+// Header and body are sent by one call, unless the socket takes less.
+static bool write_all(int fd, unsigned char * header, size_t header_size, const StringView & body,
+		const Deadline * deadline)
+{
+	struct iovec parts[2];
+	parts[0].iov_base = header;
+	parts[0].iov_len = header_size;
+	parts[1].iov_base = const_cast<char *>(body.data());
+	parts[1].iov_len = body.size();
+	return write_all(fd, parts, 2, deadline);
+}
+
+bool read_header(int fd, RequestHeader & header, const Deadline * deadline)
+{
+	unsigned char data[20];
+	if(!read_all(fd, reinterpret_cast<char *>(data), sizeof(data), deadline)) {
+		return false;
+	}
+	header.kind = get_number(data);
+	header.options = get_number(data + 4);
+	header.wrap_width = get_number(data + 8);
+	header.min_reference_links_length = get_number(data + 12);
+	header.size = get_number(data + 16);
+	return true;
+}
+
+bool read_header(int fd, ResponseHeader & header, const Deadline * deadline)
+{
+	unsigned char data[8];
+	if(!read_all(fd, reinterpret_cast<char *>(data), sizeof(data), deadline)) {
+		return false;
+	}
+	header.status = get_number(data);
+	header.size = get_number(data + 4);
+	return true;
+}
+
+bool read_body(int fd, size_t size, std::string & body, const Deadline * deadline)
+{
+	body.resize(size);
+	return size == 0 || read_all(fd, &body[0], size, deadline);
+}
+
+bool write_message(int fd, const RequestHeader & header, const StringView & body,
+		const Deadline * deadline)
+{
+	if(body.size() > MAX_BODY_SIZE) {
+		return false;
+	}
+	unsigned char data[20];
+	put_number(data, header.kind);
+	put_number(data + 4, header.options);
+	put_number(data + 8, header.wrap_width);
+	put_number(data + 12, header.min_reference_links_length);
+	put_number(data + 16, uint32_t(body.size()));
+	return write_all(fd, data, sizeof(data), body, deadline);
+}
+
+bool write_message(int fd, const ResponseHeader & header, const StringView & body,
+		const Deadline * deadline)
+{
+	if(body.size() > MAX_BODY_SIZE) {
+		return false;
+	}
+	unsigned char data[8];
+	put_number(data, header.status);
+	put_number(data + 4, uint32_t(body.size()));
+	return write_all(fd, data, sizeof(data), body, deadline);
+}
+
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include "string_view.h"
+#include "io.h"
+#include <cstdint>
+#include <string>
+
+namespace Html2Mark {
+
+// Messages of the conversion server (html2mark --serve).
+// A message is a header of 32-bit big-endian numbers
+// followed by a body of the size given in the header.
+// Request header: kind, options, wrap width, minimal length of links
+// that are made references (see html2mark()), body size; the body is HTML.
+// Response header: status, body size; the body is Markdown,
+// or counters of the server as JSON for STATS_REQUEST.
+
+enum RequestKind { CONVERT_REQUEST = 0, STATS_REQUEST = 1 };
+enum ResponseStatus { RESPONSE_CONVERTED = 0, RESPONSE_TOO_LARGE = 1, RESPONSE_BAD_REQUEST = 2 };
+
+struct RequestHeader {
+	uint32_t kind;
+	uint32_t options;
+	uint32_t wrap_width;
+	uint32_t min_reference_links_length;
+	uint32_t size;
+};
+
+struct ResponseHeader {
+	uint32_t status;
+	uint32_t size;
+};
+
+// Requests with larger bodies are refused.
+const size_t MAX_REQUEST_SIZE = 64 << 20;
+// Larger bodies do not fit into the size of the header and are not written.
+const size_t MAX_BODY_SIZE = UINT32_MAX;
+
+// Reading and writing return false on error or at the end of stream.
+// Interrupted calls are repeated. Size in the written header is the size of the body,
+// writing fails with nothing written if it is larger than MAX_BODY_SIZE.
+// Sockets that do not block are waited for up to the deadline, if it is given,
+// however slowly the other side sends or takes the data.
+bool read_header(int fd, RequestHeader & header, const Deadline * deadline = nullptr);
+bool read_header(int fd, ResponseHeader & header, const Deadline * deadline = nullptr);
+bool read_body(int fd, size_t size, std::string & body, const Deadline * deadline = nullptr);
+bool write_message(int fd, const RequestHeader & header, const StringView & body,
+		const Deadline * deadline = nullptr);
+bool write_message(int fd, const ResponseHeader & header, const StringView & body,
+		const Deadline * deadline = nullptr);
+
+}
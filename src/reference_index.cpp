@@ -0,0 +1,88 @@
+#include "reference_index.h"
+
+namespace Html2Mark {
+
+static size_t hash_target(const StringView & target)
+{
+	size_t hash = 2166136261u;
+	for(char c : target) {
+		hash = (hash ^ static_cast<unsigned char>(c)) * 16777619u;
+	}
+	return hash;
+}
+
+ReferenceIndex::ReferenceIndex()
+	: slots(16, 0)
+{}
+
+// Slots are probed linearly, so the slot of the target is either
+// the one holding it or the first empty one after its hash.
+size_t ReferenceIndex::find_slot(const StringView & target, size_t hash) const
+{
+	size_t mask = slots.size() - 1;
+	for(size_t slot = hash & mask; ; slot = (slot + 1) & mask) {
+		size_t number = slots[slot];
+		if(number == 0 || (entries[number - 1].hash == hash && this->target(number) == target)) {
+			return slot;
+		}
+	}
+}
+
+size_t ReferenceIndex::find(const StringView & target) const
+{
+	return slots[find_slot(target, hash_target(target))];
+}
+
+size_t ReferenceIndex::add(const StringView & target)
+{
+	if(2 * (entries.size() + 1) > slots.size()) {
+		grow();
+	}
+	Entry entry;
+	entry.hash = hash_target(target);
+	size_t slot = find_slot(target, entry.hash);
+	targets.append(target.data(), target.size());
+	entry.end = targets.size();
+	entries.push_back(entry);
+	slots[slot] = entries.size();
+	return entries.size();
+}
+
+StringView ReferenceIndex::target(size_t number) const
+{
+	size_t start = number > 1 ? entries[number - 2].end : 0;
+	return StringView(targets.data() + start, entries[number - 1].end - start);
+}
+
+// Targets are removed in reverse order of adding them,
+// so no remaining target was probed past their slots.
+void ReferenceIndex::truncate(size_t count)
+{
+	while(entries.size() > count) {
+		slots[find_slot(target(entries.size()), entries.back().hash)] = 0;
+		entries.pop_back();
+	}
+	targets.resize(entries.empty() ? 0 : entries.back().end);
+}
+
+// Takes time of the number of targets and not of the size of the table,
+// so that small documents are cheap after a large one.
+void ReferenceIndex::clear()
+{
+	truncate(0);
+}
+
+void ReferenceIndex::grow()
+{
+	slots.assign(2 * slots.size(), 0);
+	size_t mask = slots.size() - 1;
+	for(size_t number = 1; number <= entries.size(); ++number) {
+		size_t slot = entries[number - 1].hash & mask;
+		while(slots[slot] != 0) {
+			slot = (slot + 1) & mask;
+		}
+		slots[slot] = number;
+	}
+}
+
+}
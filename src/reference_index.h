@@ -0,0 +1,36 @@
+#pragma once
+#include "string_view.h"
+#include <string>
+#include <vector>
+
+namespace Html2Mark {
+
+// Targets of reference links (URL with optional title) numbered from 1
+// in order of their first use. A target that is used again keeps its number:
+// targets are found by hash, so each link takes constant time.
+class ReferenceIndex {
+public:
+	ReferenceIndex();
+	size_t size() const { return entries.size(); }
+	// Number of the target, or 0 if there is no such target.
+	size_t find(const StringView & target) const;
+	// Adds a target that is not in the index yet and returns its number.
+	size_t add(const StringView & target);
+	StringView target(size_t number) const;
+	// Removes targets numbered after count.
+	void truncate(size_t count);
+	void clear();
+private:
+	struct Entry {
+		size_t end;
+		size_t hash;
+	};
+	std::string targets;
+	std::vector<Entry> entries;
+	std::vector<size_t> slots; // Numbers of targets, 0 for an empty slot.
+
+	size_t find_slot(const StringView & target, size_t hash) const;
+	void grow();
+};
+
+}
@@ -0,0 +1,267 @@
+#include "result_cache.h"
+#include "io.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <atomic>
+#include <cstring>
+
+namespace Html2Mark {
+
+// Changes whenever output of the same settings changes, including changes
+// of the converter itself, so that entries stored on disk by older versions
+// are not used. It is a part of every key and of every entry file.
+static const uint32_t FORMAT_VERSION = 3;
+
+static uint64_t rotate_left(uint64_t x, int bits)
+{
+	return (x << bits) | (x >> (64 - bits));
+}
+
+static uint64_t load_word(const char * data)
+{
+	uint64_t word;
+	memcpy(&word, data, sizeof(word));
+	return word;
+}
+
+static uint64_t final_mix(uint64_t k)
+{
+	k ^= k >> 33;
+	k *= 0xff51afd7ed558ccdull;
+	k ^= k >> 33;
+	k *= 0xc4ceb9fe1a85ec53ull;
+	k ^= k >> 33;
+	return k;
+}
+
+// MurmurHash3 (x64, 128 bits), which reads 16 bytes per step.
+static CacheKey hash128(const char * data, size_t size)
+{
+	const uint64_t c1 = 0x87c37b91114253d5ull;
+	const uint64_t c2 = 0x4cf5ad432745937full;
+	uint64_t h1 = 0;
+	uint64_t h2 = 0;
+	const char * end = data + size / 16 * 16;
+	for(; data < end; data += 16) {
+		uint64_t k1 = load_word(data);
+		uint64_t k2 = load_word(data + 8);
+		h1 ^= rotate_left(k1 * c1, 31) * c2;
+		h1 = (rotate_left(h1, 27) + h2) * 5 + 0x52dce729;
+		h2 ^= rotate_left(k2 * c2, 33) * c1;
+		h2 = (rotate_left(h2, 31) + h1) * 5 + 0x38495ab5;
+	}
+	size_t tail_size = size % 16;
+	if(tail_size > 0) {
+		char tail[16] = {0};
+		memcpy(tail, data, tail_size);
+		h1 ^= rotate_left(load_word(tail) * c1, 31) * c2;
+		h2 ^= rotate_left(load_word(tail + 8) * c2, 33) * c1;
+	}
+	h1 ^= size;
+	h2 ^= size;
+	h1 += h2;
+	h2 += h1;
+	h1 = final_mix(h1);
+	h2 = final_mix(h2);
+	h1 += h2;
+	h2 += h1;
+	CacheKey key = {h1, h2};
+	return key;
+}
+
+// Settings that do not change the output of the given options
+// are left out, so that they do not split the same results.
+CacheKey make_settings_key(int options, size_t min_reference_links_length,
+		size_t wrap_width, const Limits & limits)
+{
+	uint64_t fields[] = {
+		FORMAT_VERSION, uint64_t(options),
+		(options & MAKE_REFERENCE_LINKS) ? min_reference_links_length : 0,
+		(options & WRAP) ? wrap_width : 0,
+		limits.max_depth, limits.max_output_size,
+		limits.max_references, limits.max_attribute_size,
+	};
+	return hash128(reinterpret_cast<const char *>(fields), sizeof(fields));
+}
+
+CacheKey make_cache_key(const StringView & html, const CacheKey & settings)
+{
+	CacheKey content = hash128(html.data(), html.size());
+	uint64_t fields[] = {content.low, content.high, settings.low, settings.high};
+	return hash128(reinterpret_cast<const char *>(fields), sizeof(fields));
+}
+
+CacheCounters::CacheCounters()
+	: hits(0), disk_hits(0), misses(0), evictions(0), entries(0), memory_size(0)
+{}
+
+ResultCache::ResultCache(size_t cache_max_memory_size, const std::string & cache_directory)
+	: max_memory_size(cache_max_memory_size), directory(cache_directory)
+{}
+
+ResultCache::~ResultCache()
+{}
+
+bool ResultCache::find(const CacheKey & key, const Sink & sink)
+{
+	std::shared_ptr<const std::string> result = find_in_memory(key);
+	if(result) {
+		if(!result->empty()) {
+			sink(result->data(), result->size());
+		}
+		return true;
+	}
+	std::string stored;
+	if(!directory.empty() && find_on_disk(key, sink, stored)) {
+		std::lock_guard<std::mutex> lock(mutex);
+		++stats.hits;
+		++stats.disk_hits;
+		add_to_memory(key, std::make_shared<const std::string>(std::move(stored)));
+		return true;
+	}
+	std::lock_guard<std::mutex> lock(mutex);
+	++stats.misses;
+	return false;
+}
+
+void ResultCache::add(const CacheKey & key, const StringView & result)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		add_to_memory(key, std::make_shared<const std::string>(result.data(), result.size()));
+	}
+	if(!directory.empty()) {
+		add_to_disk(key, result);
+	}
+}
+
+CacheCounters ResultCache::counters() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return stats;
+}
+
+std::shared_ptr<const std::string> ResultCache::find_in_memory(const CacheKey & key)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	auto found = index.find(key);
+	if(found == index.end()) {
+		return std::shared_ptr<const std::string>();
+	}
+	entries.splice(entries.begin(), entries, found->second);
+	++stats.hits;
+	return found->second->result;
+}
+
+// Results larger than the whole cache are not kept in memory.
+void ResultCache::add_to_memory(const CacheKey & key, const std::shared_ptr<const std::string> & result)
+{
+	if(result->size() > max_memory_size || index.count(key) > 0) {
+		return;
+	}
+	while(!entries.empty() && stats.memory_size + result->size() > max_memory_size) {
+		stats.memory_size -= entries.back().result->size();
+		index.erase(entries.back().key);
+		entries.pop_back();
+		++stats.evictions;
+	}
+	Entry entry = {key, result};
+	entries.push_front(entry);
+	index[key] = entries.begin();
+	stats.memory_size += result->size();
+	stats.entries = entries.size();
+}
+
+// Entries are sharded by the first byte of the key, as in git objects.
+std::string ResultCache::entry_path(const CacheKey & key) const
+{
+	static const char digits[] = "0123456789abcdef";
+	std::string name;
+	for(uint64_t part : {key.high, key.low}) {
+		for(int shift = 60; shift >= 0; shift -= 4) {
+			name += digits[(part >> shift) & 0xf];
+		}
+	}
+	return directory + "/" + name.substr(0, 2) + "/" + name.substr(2);
+}
+
+// Header of an entry file, followed by the result.
+struct EntryHeader {
+	char magic[4];
+	uint32_t version;
+	uint64_t key_low, key_high;
+	uint64_t size;
+};
+
+static const char ENTRY_MAGIC[4] = {'H', '2', 'M', 'C'};
+
+bool ResultCache::find_on_disk(const CacheKey & key, const Sink & sink, std::string & result) const
+{
+	int fd = open(entry_path(key).c_str(), O_RDONLY | O_CLOEXEC);
+	if(fd < 0) {
+		return false;
+	}
+	struct stat info;
+	void * mapping = MAP_FAILED;
+	size_t size = 0;
+	if(fstat(fd, &info) == 0 && size_t(info.st_size) >= sizeof(EntryHeader)) {
+		size = size_t(info.st_size);
+		mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	}
+	close(fd);
+	if(mapping == MAP_FAILED) {
+		return false;
+	}
+	const char * data = static_cast<const char *>(mapping);
+	EntryHeader header;
+	memcpy(&header, data, sizeof(header));
+	// Files that are cut short or belong to other keys are not used.
+	bool valid = memcmp(header.magic, ENTRY_MAGIC, sizeof(ENTRY_MAGIC)) == 0
+		&& header.version == FORMAT_VERSION
+		&& header.key_low == key.low && header.key_high == key.high
+		&& header.size == size - sizeof(header);
+	if(valid) {
+		if(header.size > 0) {
+			sink(data + sizeof(header), size_t(header.size));
+		}
+		result.assign(data + sizeof(header), size_t(header.size));
+	}
+	munmap(mapping, size);
+	return valid;
+}
+
+// Entries are written to temporary files and renamed,
+// so readers never see a file that is written partially.
+// Failures are not reported: the result is just not stored.
+void ResultCache::add_to_disk(const CacheKey & key, const StringView & result) const
+{
+	static std::atomic<unsigned> temp_counter(0);
+	std::string path = entry_path(key);
+	mkdir(directory.c_str(), 0755);
+	mkdir(path.substr(0, path.rfind('/')).c_str(), 0755);
+	std::string temp_path = path + "." + std::to_string(getpid())
+		+ "." + std::to_string(temp_counter++) + ".tmp";
+	int fd = open(temp_path.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+	if(fd < 0) {
+		return;
+	}
+	EntryHeader header;
+	memcpy(header.magic, ENTRY_MAGIC, sizeof(ENTRY_MAGIC));
+	header.version = FORMAT_VERSION;
+	header.key_low = key.low;
+	header.key_high = key.high;
+	header.size = result.size();
+	struct iovec parts[2];
+	parts[0].iov_base = &header;
+	parts[0].iov_len = sizeof(header);
+	parts[1].iov_base = const_cast<char *>(result.data());
+	parts[1].iov_len = result.size();
+	bool written = write_all(fd, parts, 2);
+	if(close(fd) != 0 || !written || rename(temp_path.c_str(), path.c_str()) != 0) {
+		unlink(temp_path.c_str());
+	}
+}
+
+}
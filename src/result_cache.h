@@ -0,0 +1,67 @@
+#pragma once
+#include "html2mark.h"
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace Html2Mark {
+
+// Keys are 128-bit hashes of the input together with the settings.
+CacheKey make_settings_key(int options, size_t min_reference_links_length,
+		size_t wrap_width, const Limits & limits);
+CacheKey make_cache_key(const StringView & html, const CacheKey & settings);
+
+struct CacheCounters {
+	size_t hits; // Including those from disk.
+	size_t disk_hits;
+	size_t misses;
+	size_t evictions; // Entries dropped from memory.
+	size_t entries; // In memory.
+	size_t memory_size; // Of entries in memory, in bytes.
+	CacheCounters();
+};
+
+// Results of conversions addressed by their content.
+// The latest used ones are kept in memory up to the size cap;
+// with a directory they are also stored there, one file for each,
+// and read back by mapping the file into memory, so that they are
+// shared by processes and survive restarts.
+// Only complete results (CONVERTED) are kept. May be used by several threads.
+class ResultCache {
+public:
+	explicit ResultCache(size_t max_memory_size = 64 << 20,
+			const std::string & directory = std::string());
+	~ResultCache();
+	// Gives the result to the sink and returns true, or returns false if there is none.
+	bool find(const CacheKey & key, const Sink & sink);
+	void add(const CacheKey & key, const StringView & result);
+	CacheCounters counters() const;
+private:
+	ResultCache(const ResultCache &);
+	ResultCache & operator=(const ResultCache &);
+
+	struct Entry {
+		CacheKey key;
+		std::shared_ptr<const std::string> result;
+	};
+	struct KeyHash {
+		size_t operator()(const CacheKey & key) const { return size_t(key.low); }
+	};
+	const size_t max_memory_size;
+	const std::string directory;
+	mutable std::mutex mutex;
+	std::list<Entry> entries; // The most recently used first.
+	std::unordered_map<CacheKey, std::list<Entry>::iterator, KeyHash> index;
+	CacheCounters stats;
+
+	std::shared_ptr<const std::string> find_in_memory(const CacheKey & key);
+	void add_to_memory(const CacheKey & key, const std::shared_ptr<const std::string> & result);
+	bool find_on_disk(const CacheKey & key, const Sink & sink, std::string & result) const;
+	void add_to_disk(const CacheKey & key, const StringView & result) const;
+	std::string entry_path(const CacheKey & key) const;
+};
+
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <string>
+#include <cstring>
+
+namespace Html2Mark {
+
+// Non-owning reference to a piece of text, e.g. an HTML page
+// that is already held in memory by the caller.
+class StringView {
+public:
+	StringView() : ptr(nullptr), length(0) {}
+	StringView(const char * view_data, size_t view_size)
+		: ptr(view_data), length(view_size) {}
+	StringView(const std::string & s) : ptr(s.data()), length(s.size()) {}
+
+	const char * data() const { return ptr; }
+	size_t size() const { return length; }
+	bool empty() const { return length == 0; }
+	const char * begin() const { return ptr; }
+	const char * end() const { return ptr + length; }
+	char operator[](size_t index) const { return ptr[index]; }
+	std::string str() const { return std::string(ptr, length); }
+private:
+	const char * ptr;
+	size_t length;
+};
+
+inline bool operator==(const StringView & a, const StringView & b)
+{
+	return a.size() == b.size() && (a.empty() || memcmp(a.data(), b.data(), a.size()) == 0);
+}
+
+inline bool operator!=(const StringView & a, const StringView & b)
+{
+	return !(a == b);
+}
+
+}
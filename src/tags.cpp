@@ -0,0 +1,92 @@
+#include "tags.h"
+#include <cstdint>
+#include <cstring>
+
+namespace Html2Mark {
+
+namespace {
+	const char * const TAG_NAMES[TAG_COUNT] = {
+		"",
+		"a", "b", "blockquote", "body", "br", "cite", "code", "div", "em",
+		"h1", "h2", "h3", "h4", "h5", "h6", "head", "hr", "html", "i", "img",
+		"li", "ol", "p", "pre", "script", "span", "strong", "style", "ul",
+	};
+	const size_t MAX_TAG_NAME_SIZE = 10;
+
+	// Multiplier is picked so that all known names fall into different slots.
+	// Adding a tag may require picking another one.
+	const uint64_t HASH_MULTIPLIER = 0xbfc2b3b5ea63ccb9ull;
+	const unsigned HASH_BITS = 6;
+}
+
+static char to_lower(char ch)
+{
+	return ('A' <= ch && ch <= 'Z') ? char(ch + ('a' - 'A')) : ch;
+}
+
+bool equal_ignore_case(const StringView & a, const StringView & b)
+{
+	if(a.size() != b.size()) {
+		return false;
+	}
+	for(size_t i = 0; i < a.size(); ++i) {
+		if(to_lower(a[i]) != to_lower(b[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// First eight lowercased characters mixed with the length.
+static unsigned hash_name(const char * name, size_t size)
+{
+	uint64_t key = 0;
+	for(size_t i = 0; i < size && i < 8; ++i) {
+		key |= uint64_t(uint8_t(to_lower(name[i]))) << (8 * i);
+	}
+	key ^= size;
+	return unsigned((key * HASH_MULTIPLIER) >> (64 - HASH_BITS));
+}
+
+struct TagSlots {
+	Tag slots[1 << HASH_BITS];
+	TagSlots()
+	{
+		for(Tag & slot : slots) {
+			slot = UNKNOWN_TAG;
+		}
+		for(int tag = UNKNOWN_TAG + 1; tag < TAG_COUNT; ++tag) {
+			const char * name = TAG_NAMES[tag];
+			slots[hash_name(name, strlen(name))] = Tag(tag);
+		}
+	}
+};
+
+Tag intern_tag(const StringView & name)
+{
+	static const TagSlots tag_slots;
+	if(name.empty() || name.size() > MAX_TAG_NAME_SIZE) {
+		return UNKNOWN_TAG;
+	}
+	Tag tag = tag_slots.slots[hash_name(name.data(), name.size())];
+	const char * known_name = TAG_NAMES[tag];
+	if(tag == UNKNOWN_TAG || !equal_ignore_case(name, StringView(known_name, strlen(known_name)))) {
+		return UNKNOWN_TAG;
+	}
+	return tag;
+}
+
+AttributeName intern_attribute(const StringView & name)
+{
+	static const StringView names[ATTR_COUNT] = {
+		StringView("href", 4), StringView("title", 5), StringView("src", 3), StringView("alt", 3),
+	};
+	for(int attr = 0; attr < ATTR_COUNT; ++attr) {
+		if(equal_ignore_case(name, names[attr])) {
+			return AttributeName(attr);
+		}
+	}
+	return ATTR_COUNT;
+}
+
+}
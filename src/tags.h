@@ -0,0 +1,61 @@
+#pragma once
+#include "string_view.h"
+
+namespace Html2Mark {
+
+// Tags that have special meaning for conversion.
+// Any other tag is UNKNOWN_TAG and is told apart by its name.
+enum Tag {
+	UNKNOWN_TAG,
+	TAG_A,
+	TAG_B,
+	TAG_BLOCKQUOTE,
+	TAG_BODY,
+	TAG_BR,
+	TAG_CITE,
+	TAG_CODE,
+	TAG_DIV,
+	TAG_EM,
+	TAG_H1,
+	TAG_H2,
+	TAG_H3,
+	TAG_H4,
+	TAG_H5,
+	TAG_H6,
+	TAG_HEAD,
+	TAG_HR,
+	TAG_HTML,
+	TAG_I,
+	TAG_IMG,
+	TAG_LI,
+	TAG_OL,
+	TAG_P,
+	TAG_PRE,
+	TAG_SCRIPT,
+	TAG_SPAN,
+	TAG_STRONG,
+	TAG_STYLE,
+	TAG_UL,
+	TAG_COUNT
+};
+
+// Looks tag name up ignoring case.
+// Takes constant time: the name is hashed once by a perfect hash
+// over the known names and compared to the only candidate.
+Tag intern_tag(const StringView & name);
+
+// Attributes that are used for conversion, all others are skipped.
+enum AttributeName {
+	ATTR_HREF,
+	ATTR_TITLE,
+	ATTR_SRC,
+	ATTR_ALT,
+	ATTR_COUNT
+};
+
+// Returns ATTR_COUNT for attributes that are not used.
+AttributeName intern_attribute(const StringView & name);
+
+bool equal_ignore_case(const StringView & a, const StringView & b);
+
+}
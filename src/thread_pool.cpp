@@ -0,0 +1,80 @@
+#include "thread_pool.h"
+
+namespace Html2Mark {
+
+ThreadPool::ThreadPool(size_t worker_count)
+	: unfinished(0), stopping(false)
+{
+	if(worker_count == 0) {
+		worker_count = 1;
+	}
+	for(size_t i = 0; i < worker_count; ++i) {
+		threads.emplace_back(&ThreadPool::run, this, i);
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+	}
+	has_tasks.notify_all();
+	for(std::thread & thread : threads) {
+		thread.join();
+	}
+}
+
+void ThreadPool::submit(const Task & task)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		tasks.push_back(task);
+		++unfinished;
+	}
+	has_tasks.notify_one();
+}
+
+void ThreadPool::wait()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	all_done.wait(lock, [this]() { return unfinished == 0; });
+	if(error) {
+		std::exception_ptr task_error = error;
+		error = nullptr;
+		std::rethrow_exception(task_error);
+	}
+}
+
+// Exceptions of tasks are kept for wait(), so that they
+// do not end the worker thread and the whole program with it.
+void ThreadPool::run(size_t worker)
+{
+	while(true) {
+		Task task;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			has_tasks.wait(lock, [this]() { return stopping || !tasks.empty(); });
+			if(tasks.empty()) {
+				return;
+			}
+			task = std::move(tasks.front());
+			tasks.pop_front();
+		}
+		std::exception_ptr task_error;
+		try {
+			task(worker);
+		} catch(...) {
+			task_error = std::current_exception();
+		}
+		std::lock_guard<std::mutex> lock(mutex);
+		if(task_error && !error) {
+			error = task_error;
+		}
+		if(--unfinished == 0) {
+			all_done.notify_all();
+		}
+	}
+}
+
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Html2Mark {
+
+// Fixed set of worker threads that take tasks from one shared queue
+// in the order they were submitted. Tasks are few and large (whole files,
+// pieces of a document, connections), so a single lock is not contended.
+// Task receives the index of the worker that runs it,
+// so that every worker may keep its own converter and buffers.
+class ThreadPool {
+public:
+	typedef std::function<void(size_t worker)> Task;
+
+	ThreadPool(size_t worker_count);
+	~ThreadPool();
+	size_t size() const { return threads.size(); }
+	void submit(const Task & task);
+	// Blocks until all submitted tasks are finished.
+	// If some of them threw, the first exception is thrown from here.
+	void wait();
+private:
+	std::vector<std::thread> threads;
+	std::mutex mutex;
+	std::condition_variable has_tasks;
+	std::condition_variable all_done;
+	std::deque<Task> tasks;
+	size_t unfinished;
+	std::exception_ptr error;
+	bool stopping;
+
+	void run(size_t worker);
+
+	ThreadPool(const ThreadPool &);
+	ThreadPool & operator=(const ThreadPool &);
+};
+
+}
@@ -0,0 +1,498 @@
+#include "tokenizer.h"
+#include "named_references.h"
+#include <algorithm>
+#include <cstring>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define HTML2MARK_AVX2
+#endif
+
+namespace Html2Mark {
+
+static const char * find_any_scalar(const char * pos, const char * end, char a, char b)
+{
+	for(; pos < end; ++pos) {
+		if(*pos == a || *pos == b) {
+			return pos;
+		}
+	}
+	return end;
+}
+
+#if defined(__SSE2__)
+static const char * find_any_sse2(const char * pos, const char * end, char a, char b)
+{
+	const __m128i first = _mm_set1_epi8(a);
+	const __m128i second = _mm_set1_epi8(b);
+	for(; end - pos >= 16; pos += 16) {
+		__m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pos));
+		__m128i found = _mm_or_si128(_mm_cmpeq_epi8(chunk, first), _mm_cmpeq_epi8(chunk, second));
+		unsigned mask = unsigned(_mm_movemask_epi8(found));
+		if(mask != 0) {
+			return pos + __builtin_ctz(mask);
+		}
+	}
+	return find_any_scalar(pos, end, a, b);
+}
+#endif
+
+#if defined(HTML2MARK_AVX2)
+__attribute__((target("avx2")))
+static const char * find_any_avx2(const char * pos, const char * end, char a, char b)
+{
+	const __m256i first = _mm256_set1_epi8(a);
+	const __m256i second = _mm256_set1_epi8(b);
+	for(; end - pos >= 32; pos += 32) {
+		__m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pos));
+		__m256i found = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, first), _mm256_cmpeq_epi8(chunk, second));
+		unsigned mask = unsigned(_mm256_movemask_epi8(found));
+		if(mask != 0) {
+			return pos + __builtin_ctz(mask);
+		}
+	}
+	return find_any_sse2(pos, end, a, b);
+}
+#endif
+
+typedef const char * (*FindFunction)(const char *, const char *, char, char);
+
+static FindFunction select_find_function()
+{
+#if defined(HTML2MARK_AVX2)
+	__builtin_cpu_init();
+	if(__builtin_cpu_supports("avx2")) {
+		return find_any_avx2;
+	}
+#endif
+#if defined(__SSE2__)
+	return find_any_sse2;
+#else
+	return find_any_scalar;
+#endif
+}
+
+// Returns pointer to the first occurrence of a or b in [pos, end), or end.
+static const char * find_any(const char * pos, const char * end, char a, char b)
+{
+	static const FindFunction find_function = select_find_function();
+	return find_function(pos, end, a, b);
+}
+
+const char * find_char(const char * begin, const char * end, char ch)
+{
+	return find_any(begin, end, ch, ch);
+}
+
+static bool is_space(char ch)
+{
+	return ch == ' ' || ch == '\n' || ch == '\t' || ch == '\r' || ch == '\f' || ch == '\v';
+}
+
+static bool is_alpha(char ch)
+{
+	return ('a' <= ch && ch <= 'z') || ('A' <= ch && ch <= 'Z');
+}
+
+static void append_utf8(std::string & out, unsigned code)
+{
+	if(code < 0x80) {
+		out += char(code);
+	} else if(code < 0x800) {
+		out += char(0xc0 | (code >> 6));
+		out += char(0x80 | (code & 0x3f));
+	} else if(code < 0x10000) {
+		out += char(0xe0 | (code >> 12));
+		out += char(0x80 | ((code >> 6) & 0x3f));
+		out += char(0x80 | (code & 0x3f));
+	} else {
+		out += char(0xf0 | (code >> 18));
+		out += char(0x80 | ((code >> 12) & 0x3f));
+		out += char(0x80 | ((code >> 6) & 0x3f));
+		out += char(0x80 | (code & 0x3f));
+	}
+}
+
+// Windows-1252 characters that numeric references to C1 controls stand for.
+static const unsigned short C1_REPLACEMENTS[32] = {
+	0x20ac, 0x81, 0x201a, 0x0192, 0x201e, 0x2026, 0x2020, 0x2021,
+	0x02c6, 0x2030, 0x0160, 0x2039, 0x0152, 0x8d, 0x017d, 0x8f,
+	0x90, 0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+	0x02dc, 0x2122, 0x0161, 0x203a, 0x0153, 0x9d, 0x017e, 0x0178,
+};
+
+static bool is_alnum(char ch)
+{
+	return is_alpha(ch) || ('0' <= ch && ch <= '9');
+}
+
+// Longest legacy name that is recognized without the semicolon.
+static const size_t MAX_LEGACY_REFERENCE_SIZE = 6;
+
+// Decodes character reference at pos (which points to '&')
+// and returns the number of consumed characters,
+// or zero if there is no valid reference.
+// As in HTML5, legacy names like "&copy" need no semicolon,
+// except in attribute values where they are followed by '=' or alphanumerics.
+static size_t decode_reference(const char * pos, const char * end, std::string & out,
+		bool in_attribute)
+{
+	const char * p = pos + 1;
+	if(p < end && *p == '#') {
+		++p;
+		bool hex = p < end && (*p == 'x' || *p == 'X');
+		if(hex) {
+			++p;
+		}
+		const char * digits = p;
+		unsigned long code = 0;
+		for(; p < end; ++p) {
+			unsigned digit;
+			if('0' <= *p && *p <= '9') {
+				digit = unsigned(*p - '0');
+			} else if(hex && 'a' <= (*p | 0x20) && (*p | 0x20) <= 'f') {
+				digit = unsigned((*p | 0x20) - 'a' + 10);
+			} else {
+				break;
+			}
+			if(code <= 0x10ffff) {
+				code = code * (hex ? 16 : 10) + digit;
+			}
+		}
+		if(p == digits) {
+			return 0;
+		}
+		if(p < end && *p == ';') {
+			++p;
+		}
+		if(code == 0 || code > 0x10ffff || (0xd800 <= code && code <= 0xdfff)) {
+			code = 0xfffd;
+		} else if(0x80 <= code && code <= 0x9f) {
+			code = C1_REPLACEMENTS[code - 0x80];
+		}
+		append_utf8(out, unsigned(code));
+		return size_t(p - pos);
+	}
+	const char * name = p;
+	while(p < end && size_t(p - name) <= MAX_NAMED_REFERENCE_SIZE && is_alnum(*p)) {
+		++p;
+	}
+	StringView value;
+	bool legacy;
+	if(p < end && *p == ';' && find_named_reference(StringView(name, size_t(p - name)), value, legacy)) {
+		out.append(value.data(), value.size());
+		return size_t(p + 1 - pos);
+	}
+	size_t size = std::min(size_t(p - name), MAX_LEGACY_REFERENCE_SIZE);
+	for(; size >= 2; --size) {
+		if(find_named_reference(StringView(name, size), value, legacy) && legacy) {
+			const char * next = name + size;
+			if(in_attribute && next < end && (*next == '=' || is_alnum(*next))) {
+				return 0;
+			}
+			out.append(value.data(), value.size());
+			return size + 1;
+		}
+	}
+	return 0;
+}
+
+static void append_decoded(std::string & out, const char * pos, const char * end,
+		bool in_attribute)
+{
+	while(pos < end) {
+		const char * amp = find_char(pos, end, '&');
+		out.append(pos, size_t(amp - pos));
+		if(amp == end) {
+			break;
+		}
+		size_t consumed = decode_reference(amp, end, out, in_attribute);
+		if(consumed == 0) {
+			out += '&';
+			consumed = 1;
+		}
+		pos = amp + consumed;
+	}
+}
+
+void append_text(std::string & out, const StringView & text,
+		bool collapse_whitespaces, bool trim_left, bool has_references)
+{
+	const char * pos = text.begin();
+	const char * end = text.end();
+	if(!collapse_whitespaces) {
+		if(has_references) {
+			append_decoded(out, pos, end, false);
+		} else {
+			out.append(pos, text.size());
+		}
+		return;
+	}
+	if(trim_left) {
+		const char * first = pos;
+		while(first < end && is_space(*first)) {
+			++first;
+		}
+		if(first < end) {
+			pos = first;
+		}
+	}
+	while(pos < end) {
+		if(is_space(*pos)) {
+			out += ' ';
+			while(pos < end && is_space(*pos)) {
+				++pos;
+			}
+			continue;
+		}
+		const char * word = pos;
+		while(pos < end && !is_space(*pos) && *pos != '&') {
+			++pos;
+		}
+		out.append(word, size_t(pos - word));
+		if(pos < end && *pos == '&') {
+			size_t consumed = has_references ? decode_reference(pos, end, out, false) : 0;
+			if(consumed == 0) {
+				out += '&';
+				consumed = 1;
+			}
+			pos += consumed;
+		}
+	}
+}
+
+Tokenizer::Tokenizer()
+	: pos(nullptr), end(nullptr), final(true), truncated(false), has_references(false),
+	tag_id(UNKNOWN_TAG), closing(false), self_closing(false)
+{}
+
+Tokenizer::Tokenizer(const StringView & input)
+	: pos(nullptr), end(nullptr), final(true), truncated(false), has_references(false),
+	tag_id(UNKNOWN_TAG), closing(false), self_closing(false)
+{
+	reset(input);
+}
+
+void Tokenizer::reset(const StringView & input, bool final_input)
+{
+	pos = input.begin();
+	end = input.end();
+	final = final_input;
+	truncated = false;
+	name = StringView();
+	tag_id = UNKNOWN_TAG;
+	closing = self_closing = false;
+	attrs.clear();
+	decoded_values.clear();
+	decoded_ranges.clear();
+	scan_text();
+}
+
+bool Tokenizer::next()
+{
+	if(pos >= end || needs_input()) {
+		current_text = StringView();
+		return false;
+	}
+	const char * start = pos;
+	++pos;
+	attrs.clear();
+	decoded_values.clear();
+	decoded_ranges.clear();
+	name = StringView();
+	tag_id = UNKNOWN_TAG;
+	closing = false;
+	self_closing = false;
+	if(*pos == '!' || *pos == '?') {
+		skip_markup_declaration();
+		scan_text();
+		return finish_token(start);
+	}
+	if(*pos == '/') {
+		closing = true;
+		++pos;
+	}
+	const char * name_start = pos;
+	while(pos < end && !is_space(*pos) && *pos != '/' && *pos != '>') {
+		++pos;
+	}
+	name = StringView(name_start, size_t(pos - name_start));
+	tag_id = intern_tag(name);
+	scan_attributes();
+	bool raw_text = tag_id == TAG_SCRIPT || tag_id == TAG_STYLE;
+	if(raw_text && !closing && !self_closing) {
+		scan_raw_text();
+	} else {
+		scan_text();
+	}
+	return finish_token(start);
+}
+
+bool Tokenizer::finish_token(const char * start)
+{
+	if(needs_input()) {
+		pos = start;
+		current_text = StringView();
+		return false;
+	}
+	return true;
+}
+
+void Tokenizer::scan_text()
+{
+	const char * start = pos;
+	char second = '&';
+	has_references = false;
+	while(pos < end) {
+		pos = find_any(pos, end, '<', second);
+		if(pos == end) {
+			break;
+		}
+		if(*pos == '&') {
+			has_references = true;
+			second = '<';
+			++pos;
+			continue;
+		}
+		if(pos + 1 < end) {
+			char next_char = pos[1];
+			if(is_alpha(next_char) || next_char == '!' || next_char == '?') {
+				break;
+			}
+			if(next_char == '/' && pos + 2 < end && is_alpha(pos[2])) {
+				break;
+			}
+		}
+		++pos;
+	}
+	// Text goes on up to the next tag, which may come with more input.
+	truncated = truncated || pos >= end;
+	current_text = StringView(start, size_t(pos - start));
+}
+
+void Tokenizer::scan_raw_text()
+{
+	const char * start = pos;
+	has_references = false;
+	while(pos < end) {
+		pos = find_char(pos, end, '<');
+		if(pos == end) {
+			break;
+		}
+		const char * tag_end = pos + 2 + name.size();
+		if(tag_end >= end) {
+			truncated = true;
+		}
+		if(tag_end <= end && pos[1] == '/' && equal_ignore_case(StringView(pos + 2, name.size()), name)
+				&& (tag_end == end || is_space(*tag_end) || *tag_end == '>' || *tag_end == '/')) {
+			break;
+		}
+		++pos;
+	}
+	truncated = truncated || pos >= end;
+	current_text = StringView(start, size_t(pos - start));
+}
+
+void Tokenizer::skip_markup_declaration()
+{
+	if(end - pos >= 3 && pos[0] == '!' && pos[1] == '-' && pos[2] == '-') {
+		const char * close = pos + 3;
+		while((close = find_char(close, end, '>')) != end) {
+			if(close[-1] == '-' && close[-2] == '-') {
+				break;
+			}
+			++close;
+		}
+		truncated = close >= end;
+		pos = close < end ? close + 1 : end;
+		return;
+	}
+	const char * close = find_char(pos, end, '>');
+	truncated = close >= end;
+	pos = close < end ? close + 1 : end;
+}
+
+void Tokenizer::scan_attributes()
+{
+	bool values_have_references = false;
+	truncated = true;
+	while(pos < end) {
+		while(pos < end && is_space(*pos)) {
+			++pos;
+		}
+		if(pos >= end) {
+			break;
+		}
+		if(*pos == '>') {
+			++pos;
+			truncated = false;
+			break;
+		}
+		if(*pos == '/') {
+			++pos;
+			if(pos < end && *pos == '>') {
+				self_closing = true;
+				++pos;
+				truncated = false;
+				break;
+			}
+			continue;
+		}
+		const char * attr_start = pos;
+		while(pos < end && !is_space(*pos) && *pos != '=' && *pos != '>' && *pos != '/') {
+			++pos;
+		}
+		StringView attr_name(attr_start, size_t(pos - attr_start));
+		while(pos < end && is_space(*pos)) {
+			++pos;
+		}
+		StringView value;
+		if(pos < end && *pos == '=') {
+			++pos;
+			while(pos < end && is_space(*pos)) {
+				++pos;
+			}
+			if(pos < end && (*pos == '"' || *pos == '\'')) {
+				char quote = *pos++;
+				const char * value_end = find_char(pos, end, quote);
+				value = StringView(pos, size_t(value_end - pos));
+				pos = value_end < end ? value_end + 1 : end;
+			} else {
+				const char * value_start = pos;
+				while(pos < end && !is_space(*pos) && *pos != '>') {
+					++pos;
+				}
+				value = StringView(value_start, size_t(pos - value_start));
+			}
+			if(find_char(value.begin(), value.end(), '&') != value.end()) {
+				values_have_references = true;
+			}
+		}
+		attrs.push_back(Attribute(attr_name, intern_attribute(attr_name), value));
+	}
+	if(values_have_references) {
+		decode_attribute_values();
+	}
+}
+
+void Tokenizer::decode_attribute_values()
+{
+	for(size_t i = 0; i < attrs.size(); ++i) {
+		const StringView & value = attrs[i].value;
+		if(find_char(value.begin(), value.end(), '&') != value.end()) {
+			decoded_ranges.push_back(std::make_pair(i, decoded_values.size()));
+			append_decoded(decoded_values, value.begin(), value.end(), true);
+		}
+	}
+	// Storage may be reallocated while decoding,
+	// so views are taken only after all values are decoded.
+	for(size_t n = 0; n < decoded_ranges.size(); ++n) {
+		size_t start = decoded_ranges[n].second;
+		size_t finish = n + 1 < decoded_ranges.size() ? decoded_ranges[n + 1].second : decoded_values.size();
+		attrs[decoded_ranges[n].first].value = StringView(decoded_values.data() + start, finish - start);
+	}
+}
+
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include "string_view.h"
+#include "tags.h"
+#include <string>
+#include <vector>
+
+namespace Html2Mark {
+
+struct Attribute {
+	StringView name;
+	AttributeName id;
+	StringView value;
+	Attribute(const StringView & attr_name, AttributeName attr_id, const StringView & attr_value)
+		: name(attr_name), id(attr_id), value(attr_value) {}
+};
+
+// Splits HTML into tags and text runs between them.
+// Right after construction text() is the text before the first tag,
+// every successful next() moves to the following tag and the text after it.
+// Views point into the input buffer, except for attribute values
+// that contained character references: those are decoded into
+// tokenizer-owned storage which stays valid until the next call to next().
+// Comments, doctype and processing instructions are reported
+// as tags with empty name.
+// Input that is not final may be followed by more data, so a token
+// that reaches its end is not taken: next() returns false and leaves
+// position() at the start of that token, and needs_input() is set.
+class Tokenizer {
+public:
+	Tokenizer();
+	Tokenizer(const StringView & input);
+	// Starts over on another input, keeping the allocated storage.
+	// When the input is not final, the text before the first tag
+	// is valid only if needs_input() is not set.
+	void reset(const StringView & input, bool final_input = true);
+	bool next();
+	bool needs_input() const { return truncated && !final; }
+	const StringView & text() const { return current_text; }
+	// Where the next tag starts, or the end of the input.
+	const char * position() const { return pos; }
+	bool text_has_references() const { return has_references; }
+	const StringView & tag_name() const { return name; }
+	Tag tag() const { return tag_id; }
+	bool is_closing() const { return closing; }
+	bool is_self_closing() const { return self_closing; }
+	const std::vector<Attribute> & attributes() const { return attrs; }
+private:
+	const char * pos;
+	const char * end;
+	bool final;
+	bool truncated; // Whether the current token reached the end of input.
+	StringView current_text;
+	bool has_references;
+	StringView name;
+	Tag tag_id;
+	bool closing, self_closing;
+	std::vector<Attribute> attrs;
+	std::string decoded_values;
+	std::vector<std::pair<size_t, size_t>> decoded_ranges; // Attribute index and offset.
+
+	bool finish_token(const char * start);
+	void scan_text();
+	void scan_raw_text();
+	void skip_markup_declaration();
+	void scan_attributes();
+	void decode_attribute_values();
+};
+
+// Appends text to the output, decoding character references
+// unless has_references is false.
+// When collapse_whitespaces is set, every run of whitespaces is replaced
+// by a single space, and with trim_left the leading whitespaces are dropped
+// unless the whole text is blank. Spaces that come from references
+// (like &nbsp;) are never collapsed or trimmed.
+void append_text(std::string & out, const StringView & text,
+		bool collapse_whitespaces, bool trim_left, bool has_references = true);
+
+// Returns pointer to the first occurrence of ch in [begin, end), or end.
+const char * find_char(const char * begin, const char * end, char ch);
+
+}
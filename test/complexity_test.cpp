@@ -0,0 +1,202 @@
+#include <chthon2/test.h>
+#include "../src/html2mark.h"
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <sstream>
+#include <string>
+
+// Conversion time should grow linearly with the size of input and output.
+// Output is counted as well, because some shapes (e.g. nested blockquotes)
+// produce output that is inherently quadratic in the size of input.
+// Each pathological shape is converted at size n and 8n and time per byte
+// is compared: it stays the same for linear algorithms and grows about
+// 8 times for quadratic ones. Sizes start small and grow until a conversion
+// takes long enough to be measured; no test runs longer than the time cap.
+// Times are the best of several runs, and a pair that looks too slow is
+// measured again, so that a loaded machine or a slow build (-O0,
+// sanitizers) does not fail the tests: a quadratic algorithm is slow
+// every time, noise is not.
+
+namespace {
+
+typedef std::function<std::string(size_t)> Generator;
+
+struct Measurement {
+	double seconds;
+	size_t bytes;
+	double per_byte() const { return seconds / double(bytes); }
+};
+
+const double min_measured_time = 0.03;
+const double time_cap = 30.0;
+const double max_slowdown = 3.0;
+const size_t max_size = 1 << 16;
+const int repeats = 5;
+const int max_attempts = 3;
+
+// Chunk size other than zero converts the document by PushConverter.
+Measurement measure(const std::string & html, int options, size_t wrap_width, size_t chunk_size)
+{
+	Html2Mark::Converter converter(options, 20, wrap_width);
+	std::string out;
+	Html2Mark::PushConverter push([&out](const char * data, size_t size) {
+			out.append(data, size);
+			}, options, 20, wrap_width);
+	Measurement result = {0, 0};
+	for(int i = 0; i < repeats; ++i) {
+		auto start = std::chrono::steady_clock::now();
+		if(chunk_size == 0) {
+			converter.convert(html, out);
+		} else {
+			out.clear();
+			for(size_t pos = 0; pos < html.size(); pos += chunk_size) {
+				push.feed(html.data() + pos, std::min(chunk_size, html.size() - pos));
+			}
+			push.finish();
+		}
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+		if(i == 0 || elapsed.count() < result.seconds) {
+			result.seconds = elapsed.count();
+		}
+	}
+	result.bytes = html.size() + out.size();
+	return result;
+}
+
+// Returns empty string when growth is linear, or description of the problem.
+std::string check_growth(const Generator & generate, int options, size_t wrap_width = 0,
+		size_t chunk_size = 0)
+{
+	auto started = std::chrono::steady_clock::now();
+	size_t n = 64;
+	Measurement small = measure(generate(n), options, wrap_width, chunk_size);
+	while(small.seconds < min_measured_time && n < max_size) {
+		n *= 2;
+		small = measure(generate(n), options, wrap_width, chunk_size);
+	}
+	const std::string small_html = generate(n);
+	const std::string large_html = generate(8 * n);
+	Measurement large = measure(large_html, options, wrap_width, chunk_size);
+	for(int attempt = 1; attempt < max_attempts; ++attempt) {
+		if(large.per_byte() <= max_slowdown * small.per_byte() || large.seconds <= min_measured_time) {
+			break;
+		}
+		Measurement small_again = measure(small_html, options, wrap_width, chunk_size);
+		Measurement large_again = measure(large_html, options, wrap_width, chunk_size);
+		if(large_again.per_byte() / small_again.per_byte() < large.per_byte() / small.per_byte()) {
+			small = small_again;
+			large = large_again;
+		}
+	}
+	std::chrono::duration<double> total = std::chrono::steady_clock::now() - started;
+	std::ostringstream problem;
+	if(total.count() > time_cap) {
+		problem << "took " << total.count() << "s, more than " << time_cap << "s";
+	} else if(large.per_byte() > max_slowdown * small.per_byte() && large.seconds > min_measured_time) {
+		problem << "n=" << n << ": " << small.seconds << "s for " << small.bytes << " bytes"
+			<< ", 8n: " << large.seconds << "s for " << large.bytes << " bytes";
+	}
+	return problem.str();
+}
+
+// Closing tags that were never opened are looked for through the whole
+// stack of open elements, so as many of them are added at the deepest point.
+std::string nested(size_t depth, const char * const tags[], size_t tag_count, const char * stray)
+{
+	std::string html;
+	for(size_t i = 0; i < depth; ++i) {
+		html += std::string("<") + tags[i % tag_count] + ">x ";
+	}
+	for(size_t i = 0; i < depth; ++i) {
+		html += std::string("</") + stray + ">";
+	}
+	for(size_t i = depth; i > 0; --i) {
+		html += std::string("</") + tags[(i - 1) % tag_count] + ">";
+	}
+	return html;
+}
+
+}
+
+SUITE(complexity) {
+
+TEST(should_convert_deep_nesting_in_linear_time)
+{
+	static const char * const tags[] = {"div", "span", "b", "i", "a", "em"};
+	EQUAL(check_growth([](size_t n) { return nested(n, tags, 6, "p"); },
+				Html2Mark::DEFAULT_OPTIONS), "");
+}
+
+TEST(should_convert_deep_nesting_of_unknown_tags_in_linear_time)
+{
+	static const char * const tags[] = {"foo", "bar", "baz"};
+	EQUAL(check_growth([](size_t n) { return nested(n, tags, 3, "qux"); },
+				Html2Mark::DEFAULT_OPTIONS), "");
+}
+
+TEST(should_wrap_long_lines_in_linear_time)
+{
+	Generator generate = [](size_t n) {
+		std::string html = "<p>";
+		for(size_t i = 0; i < n; ++i) {
+			html += "lorem ipsum dolor ";
+		}
+		return html + "</p><pre>" + std::string(n * 16, 'x') + "</pre>";
+	};
+	EQUAL(check_growth(generate, Html2Mark::DEFAULT_OPTIONS | Html2Mark::WRAP, 40), "");
+}
+
+TEST(should_convert_dense_color_changes_in_linear_time)
+{
+	Generator generate = [](size_t n) {
+		std::string html = "<p>";
+		for(size_t i = 0; i < n; ++i) {
+			html += "<b>a<i>b<code>c</code></i></b><em>d</em> ";
+		}
+		return html + "</p>";
+	};
+	EQUAL(check_growth(generate, Html2Mark::DEFAULT_OPTIONS | Html2Mark::COLORS | Html2Mark::WRAP, 60), "");
+}
+
+TEST(should_convert_many_list_items_in_linear_time)
+{
+	Generator generate = [](size_t n) {
+		std::string html = "<ol>";
+		for(size_t i = 0; i < n; ++i) {
+			html += "<li>item <b>bold</b><ul><li>nested</li></ul></li>";
+		}
+		return html + "</ol>";
+	};
+	EQUAL(check_growth(generate, Html2Mark::DEFAULT_OPTIONS), "");
+}
+
+TEST(should_convert_many_links_in_linear_time)
+{
+	Generator generate = [](size_t n) {
+		std::string html = "<p>";
+		for(size_t i = 0; i < n; ++i) {
+			html += "<a href=\"http://www.example.com/some/long/path/" + std::to_string(i) + "\">link</a> ";
+		}
+		return html + "</p>";
+	};
+	EQUAL(check_growth(generate, Html2Mark::DEFAULT_OPTIONS | Html2Mark::MAKE_REFERENCE_LINKS), "");
+}
+
+TEST(should_push_long_tokens_in_small_chunks_in_linear_time)
+{
+	Generator generate = [](size_t n) {
+		std::string html = "<p>text</p><!--";
+		for(size_t i = 0; i < n; ++i) {
+			html += "<p>commented out</p>";
+		}
+		html += "--><pre>";
+		for(size_t i = 0; i < n; ++i) {
+			html += "long text without tags ";
+		}
+		return html + "</pre>";
+	};
+	EQUAL(check_growth(generate, Html2Mark::DEFAULT_OPTIONS, 0, 7), "");
+}
+
+}
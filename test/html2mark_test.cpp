@@ -1,8 +1,50 @@
 #include <chthon2/test.h>
 #include <chthon2/log.h>
 #include "../src/html2mark.h"
+#include "../src/line_wrapper.h"
+#include "../src/color_normalizer.h"
+#include "../src/protocol.h"
+#include "../src/html2mark_c.h"
+#include "../src/result_cache.h"
+#include "../src/thread_pool.h"
+#include <vector>
+#include <sstream>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <sys/socket.h>
+#include <fcntl.h>
+#include <unistd.h>
 using Html2Mark::html2mark;
 
+// Sizes of heap allocations are summed up,
+// so that tests can check that memory use is bounded.
+static std::atomic<size_t> allocated_size(0);
+// When set to n, the n-th next allocation fails.
+static std::atomic<size_t> failing_allocation(0);
+
+void * operator new(size_t size)
+{
+	allocated_size += size;
+	if(failing_allocation > 0 && --failing_allocation == 0) {
+		throw std::bad_alloc();
+	}
+	void * ptr = malloc(size == 0 ? 1 : size);
+	if(ptr == nullptr) {
+		throw std::bad_alloc();
+	}
+	return ptr;
+}
+
+void operator delete(void * ptr) noexcept
+{
+	free(ptr);
+}
+
 int main(int argc, char ** argv)
 {
 	return Chthon::run_all_tests(argc, argv);
@@ -201,6 +243,21 @@ TEST(should_make_reference_style_link_for_long_a_links)
 		 );
 }
 
+TEST(should_reuse_reference_for_same_link_target)
+{
+	EQUAL(
+			html2mark(
+				"<a href=\"http://example.com\">One</a> "
+				"<a href=\"http://example.com\" title=\"Title\">Two</a> "
+				"<img src=\"http://example.com\" alt=\"Three\"/> "
+				"<a href=\"http://example.com\" title=\"Title\">Four</a>",
+				Html2Mark::MAKE_REFERENCE_LINKS, 15),
+			"[One][1] [Two][2] ![Three][1] [Four][2]\n\n"
+			"[1]: http://example.com\n"
+			"[2]: http://example.com \"Title\"\n"
+		 );
+}
+
 TEST(should_remove_extra_whitespaces_in_a_tag)
 {
 	EQUAL(html2mark("<a href=\"http://example.com/\">   \nSome\n\ttext</a>"),
@@ -320,6 +377,91 @@ TEST(should_pass_span_tags)
 			"\nSome text **with bold _and italic_**\n");
 }
 
+TEST(should_skip_comments_and_doctype)
+{
+	EQUAL(html2mark("<!DOCTYPE html><p>Text</p>"), "\nText\n");
+	EQUAL(html2mark("Text <!-- <b>comment</b> --> more"), "Text more");
+}
+
+TEST(should_decode_character_references)
+{
+	EQUAL(html2mark("a &lt;b&gt; &amp; &#x41;&#66; &unknown; & c"), "a <b> & AB &unknown; & c");
+	EQUAL(html2mark("<a href=\"/?a=1&amp;b=2\">Text</a>"), "[Text](/?a=1&b=2)");
+}
+
+TEST(should_decode_all_html5_named_references)
+{
+	EQUAL(html2mark("&mdash;&hellip;&NotNestedGreaterGreater;&CounterClockwiseContourIntegral;"),
+			"\xe2\x80\x94\xe2\x80\xa6\xe2\xaa\xa2\xcc\xb8\xe2\x88\xb3");
+	EQUAL(html2mark("&copy2023 &notit; &amp &ampx"), "\xc2\xa9" "2023 \xc2\xac" "it; & &x");
+	EQUAL(html2mark("&#150; &#x80;"), "\xe2\x80\x93 \xe2\x82\xac");
+}
+
+TEST(should_keep_legacy_references_followed_by_alphanumerics_in_attributes)
+{
+	EQUAL(html2mark("<a href=\"/?a=1&copy=2&ampx&amp\">Text</a>"), "[Text](/?a=1&copy=2&ampx&)");
+}
+
+TEST(should_keep_literal_less_than_sign_in_text)
+{
+	EQUAL(html2mark("1 < 2 <b>and</b> 3 </ 4"), "1 < 2 **and** 3 </ 4");
+}
+
+TEST(should_accept_unquoted_attribute_values)
+{
+	EQUAL(html2mark("<a href=http://example.com/>Text</a>"), "[Text](http://example.com/)");
+}
+
+TEST(should_keep_decoded_attributes_of_open_links)
+{
+	std::string html = "<a href=\"/a?x=1&amp;y=2\" title=\"&quot;A&quot;\">A <a href=\"/b&lt;\">B</a></a>";
+	EQUAL(html2mark(html), "[A [B](/b<)](/a?x=1&y=2 \"\"A\"\")");
+}
+
+TEST(should_not_parse_tags_inside_script_and_style)
+{
+	EQUAL(html2mark("<head><script>if(a<b) x = '</p>';</script></head>Text"), "Text");
+}
+
+TEST(should_skip_script_and_style_outside_of_head)
+{
+	EQUAL(html2mark("<style>p{}</style>Text"), "Text");
+	EQUAL(html2mark("<p>One</p><script>if(a<b){}</script><p>two</p>"), "\nOne\n\ntwo\n");
+	EQUAL(html2mark("<body><p>One</p><style>p{}</style><p>two</p></body>"), "One\n\ntwo");
+}
+
+TEST(should_not_render_known_tags_as_unknown)
+{
+	const char * names[] = {
+		"a", "b", "blockquote", "body", "br", "cite", "code", "div", "em",
+		"h1", "h2", "h3", "h4", "h5", "h6", "head", "hr", "html", "i", "img",
+		"li", "ol", "p", "pre", "script", "span", "strong", "style", "ul",
+	};
+	for(const char * name : names) {
+		std::string html = std::string("<") + name + ">a<" + name + ">b</" + name + "></" + name + ">c";
+		std::string markdown = html2mark(html);
+		ASSERT(markdown.find("<") == std::string::npos);
+	}
+	EQUAL(html2mark("<script>if(a<b){}</script><p>t</p>"), "\nt\n");
+}
+
+TEST(should_recognize_tags_in_any_case)
+{
+	EQUAL(html2mark("<P>Some <B>text</b></p>"), "\nSome **text**\n");
+	EQUAL(html2mark("<UL><Li>one<LI>two</Ul>"), "\n* one\n* two\n");
+}
+
+TEST(should_keep_unknown_tags_and_close_them_by_name)
+{
+	EQUAL(html2mark("<Foo>a</bar>b</FOO>c"), "<Foo>ab</Foo>c");
+}
+
+TEST(should_close_self_closing_unknown_tags_at_once)
+{
+	EQUAL(html2mark("<p>a<foo/>b <i>c</i></p>"), "\na<foo></foo>b _c_\n");
+	EQUAL(html2mark("<svg><path d='x'/><path/></svg>text"), "<svg><path></path><path></path></svg>text");
+}
+
 TEST(should_collapse_empty_lines)
 {
 	std::string data =
@@ -408,6 +550,14 @@ TEST(should_mark_headers_with_purple)
 			"[0m\n[00;35m# [00;36mHello, [01;35mworld[0m\n[0m");
 }
 
+TEST(should_mark_strong_text_in_any_header_level_with_bold_purple)
+{
+	EQUAL(html2mark("<h6>Hello, <b>world</b></h6>", Html2Mark::COLORS),
+			"[0m\n[00;35m###### Hello, [01;35mworld[0m\n[0m");
+	EQUAL(html2mark("<h4>Hello, <b>world</b></h4>", Html2Mark::COLORS),
+			"[0m\n[00;35m#### Hello, [01;35mworld[0m\n[0m");
+}
+
 TEST(should_mark_rulers_with_purple)
 {
 	EQUAL(html2mark("<hr>", Html2Mark::COLORS),
@@ -594,6 +744,14 @@ TEST(should_correctly_calculate_length_of_utf8_headers)
 		 );
 }
 
+TEST(should_underline_headings_by_display_width)
+{
+	EQUAL(html2mark("<h1>\xe4\xb8\xad\xe6\x96\x87\xe6\xa0\x87\xe9\xa2\x98</h1>", Html2Mark::UNDERSCORED_HEADINGS),
+			"\n\xe4\xb8\xad\xe6\x96\x87\xe6\xa0\x87\xe9\xa2\x98\n========\n");
+	EQUAL(html2mark("<h2>Cafe\xcc\x81 \xf0\x9f\x98\x80</h2>", Html2Mark::UNDERSCORED_HEADINGS),
+			"\nCafe\xcc\x81 \xf0\x9f\x98\x80\n-------\n");
+}
+
 TEST(should_correctly_word_wrap_an_utf8_text)
 {
 	std::string lorem_russian =
@@ -616,3 +774,766 @@ TEST(should_correctly_word_wrap_an_utf8_text)
 }
 
 }
+
+SUITE(line_wrapper) {
+
+using Html2Mark::wrap_lines;
+
+TEST(should_wrap_plain_text)
+{
+	EQUAL(wrap_lines("Lorem ipsum dolor sit amet", 11), "Lorem ipsum\ndolor sit\namet");
+}
+
+TEST(should_count_utf8_characters_not_bytes)
+{
+	EQUAL(wrap_lines("\xe2\x82\xac\xe2\x82\xac\xe2\x82\xac \xf0\x9f\x98\x80\xf0\x9f\x98\x80", 4),
+			"\xe2\x82\xac\xe2\x82\xac\xe2\x82\xac\n\xf0\x9f\x98\x80\xf0\x9f\x98\x80");
+	EQUAL(wrap_lines("\xd0\xb0\xd0\xb1\xd0\xb2\xd0\xb3", 3), "\xd0\xb0\xd0\xb1\xd0\xb2\n\xd0\xb3");
+}
+
+TEST(should_count_east_asian_wide_characters_as_two_columns)
+{
+	std::string ideographs;
+	for(int i = 0; i < 10; ++i) {
+		ideographs += "\xe4\xb8\xad";
+	}
+	EQUAL(wrap_lines(ideographs, 8), ideographs.substr(0, 12) + "\n" + ideographs.substr(12, 12) + "\n" + ideographs.substr(24));
+	EQUAL(wrap_lines("\xe3\x81\x82\xe3\x81\x82 \xea\xb0\x80\xea\xb0\x80", 5), "\xe3\x81\x82\xe3\x81\x82\n\xea\xb0\x80\xea\xb0\x80");
+}
+
+TEST(should_keep_combining_marks_with_their_characters)
+{
+	const std::string accented = "e\xcc\x81";
+	EQUAL(wrap_lines(accented + accented + accented + " " + accented, 3),
+			accented + accented + accented + "\n" + accented);
+	EQUAL(wrap_lines("\xe4\xb8\xad\xe2\x80\x8b\xe4\xb8\xad", 2), "\xe4\xb8\xad\xe2\x80\x8b\n\xe4\xb8\xad");
+}
+
+TEST(should_advance_tabs_to_next_tab_stop)
+{
+	EQUAL(wrap_lines("ab\tcd ef", 10), "ab\tcd\nef");
+	EQUAL(wrap_lines("ab\tcd ef", 10, 4), "ab\tcd ef");
+}
+
+TEST(should_wrap_the_last_line)
+{
+	EQUAL(wrap_lines("Lorem ipsum", 10), "Lorem\nipsum");
+}
+
+TEST(should_give_same_result_for_any_chunks)
+{
+	std::string text = "Lorem @[00;36mipsum \xd0\xb4\xd0\xbe\xd0\xbb\xd0\xbe\xd1\x80@[0m sit\tamet,\n"
+		"@[01;37mconsectetur adipisicing elit@[0m, sed do eiusmod tempor";
+	std::replace(text.begin(), text.end(), '@', '\x1b');
+	std::string expected = wrap_lines(text, 12);
+	for(size_t chunk_size = 1; chunk_size < 8; ++chunk_size) {
+		std::string result;
+		Html2Mark::LineWrapper wrapper(12);
+		for(size_t pos = 0; pos < text.size(); pos += chunk_size) {
+			wrapper.process(text.data() + pos, std::min(chunk_size, text.size() - pos), result);
+		}
+		wrapper.finish(result);
+		EQUAL(result, expected);
+	}
+}
+
+}
+
+SUITE(color_normalizer) {
+
+static std::string normalize(const std::string & text, size_t chunk_size)
+{
+	std::string result;
+	Html2Mark::ColorNormalizer normalizer;
+	for(size_t pos = 0; pos < text.size(); pos += chunk_size) {
+		normalizer.process(text.data() + pos, std::min(chunk_size, text.size() - pos), result);
+	}
+	normalizer.finish(result);
+	return result;
+}
+
+static std::string escaped(std::string text)
+{
+	std::replace(text.begin(), text.end(), '@', '\x1b');
+	return text;
+}
+
+TEST(should_restore_outer_color_on_reset)
+{
+	std::string text = escaped("a@[01;37mb@[00;36mc@[0md@[0m@[0me");
+	for(size_t chunk_size = 1; chunk_size <= text.size(); ++chunk_size) {
+		EQUAL(normalize(text, chunk_size), escaped("a@[01;37mb@[00;36mc@[01;37md@[0me@[0m"));
+	}
+}
+
+TEST(should_drop_overridden_sequences)
+{
+	std::string text = escaped("x@[00;35m@[01;37my@[0mz");
+	for(size_t chunk_size = 1; chunk_size <= text.size(); ++chunk_size) {
+		EQUAL(normalize(text, chunk_size), escaped("x@[01;37my@[00;35mz@[0m"));
+	}
+}
+
+}
+
+SUITE(sink) {
+
+static std::vector<std::string> collect_blocks(const std::string & html, int options = Html2Mark::DEFAULT_OPTIONS,
+		size_t min_reference_links_length = 20, size_t wrap_width = 80)
+{
+	std::vector<std::string> blocks;
+	html2mark(html, [&blocks](const char * data, size_t size) {
+			blocks.push_back(std::string(data, size));
+			}, options, min_reference_links_length, wrap_width);
+	return blocks;
+}
+
+static std::string join(const std::vector<std::string> & blocks)
+{
+	std::string result;
+	for(const std::string & block : blocks) {
+		result += block;
+	}
+	return result;
+}
+
+TEST(should_emit_each_top_level_block_separately)
+{
+	std::vector<std::string> blocks = collect_blocks("<p>one</p><p>two <b>three</b></p>");
+	EQUAL(blocks.size(), 2u);
+	EQUAL(blocks[0], "\none\n");
+	EQUAL(blocks[1], "\ntwo **three**\n");
+}
+
+TEST(should_emit_same_output_as_string_version)
+{
+	std::string data =
+		"<h1>Title</h1><p>Some <i>text</i> with <a href=\"http://example.com/long/link\">link</a>.</p>"
+		"<ul><li>one<li>two</ul><blockquote><p>quote <b>bold</b></p></blockquote>";
+	int options = Html2Mark::MAKE_REFERENCE_LINKS | Html2Mark::UNDERSCORED_HEADINGS;
+	EQUAL(join(collect_blocks(data, options)), html2mark(data, options));
+	options |= Html2Mark::COLORS;
+	EQUAL(join(collect_blocks(data, options)), html2mark(data, options));
+}
+
+TEST(should_carry_colors_and_wrapping_across_blocks)
+{
+	std::string data =
+		"<p><i>Lorem ipsum dolor</i> sit <b>amet</b></p> <b>consectetur</b> "
+		"<i>adipisicing elit, sed do</i> eiusmod tempor incididunt ut labore.";
+	int options = Html2Mark::COLORS | Html2Mark::WRAP;
+	std::string expected =
+		"[0m\n"
+		"[00;36mLorem ipsum dolor[0m sit [01;37mamet[0m\n"
+		"[01;37mconsectetur[0m [00;36madipisicing elit,[0m\n"
+		"[00;36msed do[0m eiusmod tempor\n"
+		"incididunt ut labore.[0m";
+	EQUAL(join(collect_blocks(data, options, 20, 30)), expected);
+	EQUAL(html2mark(data, options, 20, 30), expected);
+}
+
+}
+
+SUITE(buffer) {
+
+TEST(should_convert_html_from_memory_buffer)
+{
+	std::string data = "<p>Some <b>text</b></p> and more";
+	Html2Mark::StringView view(data.data(), 23);
+	EQUAL(html2mark(view), "\nSome **text**\n");
+	EQUAL(html2mark(Html2Mark::StringView(data)), html2mark(data));
+}
+
+}
+
+SUITE(converter) {
+
+TEST(should_convert_each_document_as_if_it_was_the_only_one)
+{
+	std::vector<std::string> documents = {
+		"<ul><li>one<li>two <a href=\"http://example.com/a/very/long/link\">link</a>",
+		"<blockquote><i>unclosed color and a line that is long enough to be wrapped",
+		"<ol><li>first</li></ol><p>Text <a href=\"http://example.com/another/long/link\">x</a></p>",
+		"",
+		"<pre>int main()\n{\n\treturn 0;\n}</pre><foo>unknown",
+	};
+	for(int options : {int(Html2Mark::MAKE_REFERENCE_LINKS), Html2Mark::COLORS | Html2Mark::WRAP | Html2Mark::MAKE_REFERENCE_LINKS}) {
+		Html2Mark::Converter converter(options, 20, 30);
+		std::string out;
+		for(int pass = 0; pass < 2; ++pass) {
+			for(const std::string & html : documents) {
+				converter.convert(html, out);
+				EQUAL(out, html2mark(html, options, 20, 30));
+			}
+		}
+	}
+}
+
+}
+
+SUITE(limits) {
+
+TEST(should_ignore_tags_nested_too_deep)
+{
+	Html2Mark::Limits limits;
+	limits.max_depth = 2;
+	Html2Mark::Converter converter(Html2Mark::DEFAULT_OPTIONS, 20, 80, limits);
+	std::string out;
+	EQUAL(converter.convert(std::string("<p><b><i>deep</i> text</b></p><b>x</b>"), out), Html2Mark::CONVERTED);
+	EQUAL(out, "\n**deep text**\n**x**");
+}
+
+TEST(should_write_links_inline_after_max_references)
+{
+	Html2Mark::Limits limits;
+	limits.max_references = 1;
+	Html2Mark::Converter converter(Html2Mark::MAKE_REFERENCE_LINKS, 20, 80, limits);
+	std::string out;
+	converter.convert(std::string("<a href=\"http://example.com/first/long/link\">one</a> "
+				"<a href=\"http://example.com/second/long/link\">two</a>"), out);
+	EQUAL(out, "[one][1] [two](http://example.com/second/long/link)\n\n"
+			"[1]: http://example.com/first/long/link\n");
+}
+
+TEST(should_ignore_too_long_attributes)
+{
+	Html2Mark::Limits limits;
+	limits.max_attribute_size = 10;
+	Html2Mark::Converter converter(Html2Mark::DEFAULT_OPTIONS, 20, 80, limits);
+	std::string out;
+	converter.convert(std::string("<a href=\"http://example.com/\">site</a> <a href=\"/\">root</a>"), out);
+	EQUAL(out, "site [root](/)");
+}
+
+TEST(should_stop_before_output_grows_beyond_max_size)
+{
+	Html2Mark::Limits limits;
+	limits.max_output_size = 20;
+	Html2Mark::Converter converter(Html2Mark::DEFAULT_OPTIONS, 20, 80, limits);
+	std::string out;
+	EQUAL(converter.convert(std::string("<p>first</p><p>second paragraph</p><p>third</p>"), out),
+			Html2Mark::OUTPUT_TOO_LARGE);
+	EQUAL(out, "\nfirst\n");
+	EQUAL(converter.convert(std::string("<p>short</p>"), out), Html2Mark::CONVERTED);
+	EQUAL(out, "\nshort\n");
+}
+
+TEST(should_not_count_content_that_is_dropped_against_max_output_size)
+{
+	Html2Mark::Limits limits;
+	limits.max_output_size = 40;
+	Html2Mark::Converter converter(Html2Mark::DEFAULT_OPTIONS, 20, 80, limits);
+	std::string out;
+	std::string script(200, 'x');
+	EQUAL(converter.convert("<p>first</p><p>second</p><script>" + script, out), Html2Mark::CONVERTED);
+	EQUAL(out, "\nfirst\n\nsecond\n");
+	EQUAL(converter.convert("<ul><li>one<head><ul><li>" + script + "</ul></head><li>two</ul>", out),
+			Html2Mark::CONVERTED);
+	EQUAL(out, "\n* one\n* two\n");
+}
+
+}
+
+SUITE(stats) {
+
+TEST(should_count_what_conversion_took)
+{
+	std::string html = "<p>Some <b>text</b> <a href=\"http://example.com/a/very/long/link\">link</a></p>"
+		"<ul><li>one<li>two <i>three</i></ul>";
+	Html2Mark::Stats stats;
+	std::string out = html2mark(html, Html2Mark::MAKE_REFERENCE_LINKS, 20, 80, &stats);
+	EQUAL(out, html2mark(html, Html2Mark::MAKE_REFERENCE_LINKS));
+	EQUAL(stats.tokens, 12u);
+	EQUAL(stats.elements, 7u);
+	EQUAL(stats.max_depth, 3u);
+	EQUAL(stats.references, 1u);
+	EQUAL(stats.input_size, html.size());
+	EQUAL(stats.output_size, out.size());
+}
+
+}
+
+SUITE(result_cache) {
+
+TEST(should_give_cached_result_on_second_conversion)
+{
+	Html2Mark::ResultCache cache;
+	Html2Mark::Converter converter(Html2Mark::MAKE_REFERENCE_LINKS);
+	converter.use_cache(&cache);
+	std::string html = "<p><a href=\"http://example.com/a/long/link\">link</a></p>";
+	std::string first, second;
+	EQUAL(converter.convert(html, first), Html2Mark::CONVERTED);
+	EQUAL(converter.convert(html, second), Html2Mark::CONVERTED);
+	EQUAL(second, first);
+	EQUAL(first, html2mark(html, Html2Mark::MAKE_REFERENCE_LINKS));
+	EQUAL(cache.counters().misses, 1u);
+	EQUAL(cache.counters().hits, 1u);
+}
+
+TEST(should_key_results_on_settings_that_change_output)
+{
+	Html2Mark::ResultCache cache;
+	std::string html = "<h1>Header</h1>";
+	std::string out;
+	Html2Mark::Converter plain(Html2Mark::DEFAULT_OPTIONS, 20, 80);
+	plain.use_cache(&cache);
+	plain.convert(html, out);
+	Html2Mark::Converter underscored(Html2Mark::UNDERSCORED_HEADINGS, 20, 80);
+	underscored.use_cache(&cache);
+	underscored.convert(html, out);
+	EQUAL(out, html2mark(html, Html2Mark::UNDERSCORED_HEADINGS));
+	EQUAL(cache.counters().misses, 2u);
+	// Without wrapping, width does not change the output.
+	Html2Mark::Converter other_width(Html2Mark::DEFAULT_OPTIONS, 20, 40);
+	other_width.use_cache(&cache);
+	other_width.convert(html, out);
+	EQUAL(out, html2mark(html));
+	EQUAL(cache.counters().hits, 1u);
+}
+
+TEST(should_drop_least_recently_used_results)
+{
+	Html2Mark::ResultCache cache(10);
+	Html2Mark::CacheKey settings = Html2Mark::make_settings_key(0, 20, 80, Html2Mark::Limits());
+	Html2Mark::CacheKey a = Html2Mark::make_cache_key(std::string("a"), settings);
+	Html2Mark::CacheKey b = Html2Mark::make_cache_key(std::string("b"), settings);
+	Html2Mark::CacheKey c = Html2Mark::make_cache_key(std::string("c"), settings);
+	cache.add(a, std::string("aaaa"));
+	cache.add(b, std::string("bbbb"));
+	std::string found;
+	Html2Mark::Sink sink = [&found](const char * data, size_t size) { found.append(data, size); };
+	ASSERT(cache.find(a, sink));
+	cache.add(c, std::string("cccc"));
+	ASSERT(!cache.find(b, sink));
+	ASSERT(cache.find(c, sink));
+	EQUAL(found, "aaaacccc");
+	EQUAL(cache.counters().evictions, 1u);
+	EQUAL(cache.counters().memory_size, 8u);
+}
+
+TEST(should_read_results_stored_on_disk_by_another_cache)
+{
+	char directory[] = "/tmp/html2mark_test_XXXXXX";
+	ASSERT(mkdtemp(directory) != nullptr);
+	Html2Mark::CacheKey settings = Html2Mark::make_settings_key(0, 20, 80, Html2Mark::Limits());
+	Html2Mark::CacheKey key = Html2Mark::make_cache_key(std::string("<p>text</p>"), settings);
+	{
+		Html2Mark::ResultCache cache(1024, directory);
+		cache.add(key, std::string("text\n"));
+	}
+	Html2Mark::ResultCache cache(1024, directory);
+	std::string found;
+	ASSERT(cache.find(key, [&found](const char * data, size_t size) { found.append(data, size); }));
+	EQUAL(found, "text\n");
+	EQUAL(cache.counters().disk_hits, 1u);
+	Html2Mark::CacheKey other = Html2Mark::make_cache_key(std::string("<p>other</p>"), settings);
+	ASSERT(!cache.find(other, [](const char *, size_t) {}));
+	std::string cleanup = std::string("rm -rf ") + directory;
+	EQUAL(system(cleanup.c_str()), 0);
+}
+
+TEST(should_ignore_results_stored_by_another_format_version)
+{
+	char directory[] = "/tmp/html2mark_test_XXXXXX";
+	ASSERT(mkdtemp(directory) != nullptr);
+	Html2Mark::CacheKey settings = Html2Mark::make_settings_key(0, 20, 80, Html2Mark::Limits());
+	Html2Mark::CacheKey key = Html2Mark::make_cache_key(std::string("<p>text</p>"), settings);
+	{
+		Html2Mark::ResultCache cache(1024, directory);
+		cache.add(key, std::string("text\n"));
+	}
+	// Entries are named by the key in hex, the version follows the magic.
+	char name[40];
+	snprintf(name, sizeof(name), "%016llx%016llx",
+			static_cast<unsigned long long>(key.high), static_cast<unsigned long long>(key.low));
+	std::string path = std::string(directory) + "/" + std::string(name, 2) + "/" + (name + 2);
+	int fd = open(path.c_str(), O_WRONLY);
+	ASSERT(fd >= 0);
+	uint32_t other_version = 0xffffffffu;
+	EQUAL(pwrite(fd, &other_version, sizeof(other_version), 4), ssize_t(sizeof(other_version)));
+	close(fd);
+	Html2Mark::ResultCache cache(1024, directory);
+	ASSERT(!cache.find(key, [](const char *, size_t) {}));
+	EQUAL(cache.counters().disk_hits, 0u);
+	std::string cleanup = std::string("rm -rf ") + directory;
+	EQUAL(system(cleanup.c_str()), 0);
+}
+
+TEST(should_not_cache_incomplete_results)
+{
+	Html2Mark::ResultCache cache;
+	Html2Mark::Limits limits;
+	limits.max_output_size = 8;
+	Html2Mark::Converter converter(Html2Mark::DEFAULT_OPTIONS, 20, 80, limits);
+	converter.use_cache(&cache);
+	std::string out;
+	EQUAL(converter.convert(std::string("<p>long enough text</p>"), out), Html2Mark::OUTPUT_TOO_LARGE);
+	EQUAL(converter.convert(std::string("<p>long enough text</p>"), out), Html2Mark::OUTPUT_TOO_LARGE);
+	EQUAL(cache.counters().hits, 0u);
+	EQUAL(cache.counters().entries, 0u);
+}
+
+}
+
+SUITE(push_converter) {
+
+TEST(should_convert_document_fed_byte_by_byte)
+{
+	std::string html = "<!DOCTYPE html><h1 class=\"t\">Заголовок</h1><!-- <p>no</p> -->"
+		"<p>a&amp;b &#x44f; <a href=\"http://example.com/a/long/link?x=1&amp;y=2\">link</a></p>"
+		"<script>if(a<b) document.write('<p>');</script><pre>  keep\n  spaces</pre>€ end";
+	int options = Html2Mark::UNDERSCORED_HEADINGS | Html2Mark::MAKE_REFERENCE_LINKS;
+	std::string out;
+	Html2Mark::PushConverter converter([&out](const char * data, size_t size) {
+			out.append(data, size);
+			}, options);
+	for(char c : html) {
+		converter.feed(&c, 1);
+	}
+	EQUAL(converter.finish(), Html2Mark::CONVERTED);
+	EQUAL(out, html2mark(html, options));
+}
+
+TEST(should_not_keep_elements_of_finished_blocks)
+{
+	size_t written = 0;
+	Html2Mark::PushConverter converter([&written](const char *, size_t size) {
+			written += size;
+			});
+	std::string block;
+	for(size_t i = 0; i < 100; ++i) {
+		block = "<p><a href=\"http://example.com/" + std::to_string(i) + std::string(200, 'x')
+			+ "\" title=\"Title\">link</a></p>";
+		converter.feed(block.data(), block.size());
+	}
+	size_t before = allocated_size;
+	for(size_t i = 0; i < 5000; ++i) {
+		converter.feed(block.data(), block.size());
+	}
+	// About 1 MB of elements went through, nothing of them is kept.
+	ASSERT(allocated_size - before < 64 * 1024);
+	EQUAL(converter.finish(), Html2Mark::CONVERTED);
+	ASSERT(written > 5000 * 200);
+}
+
+TEST(should_convert_stream_as_it_is_read)
+{
+	std::string html;
+	while(html.size() < 4 * 1024 * 1024) {
+		html += "<p>Lorem <a href=\"http://example.com/" + std::to_string(html.size()) + "\">ipsum</a> dolor</p>";
+	}
+	std::istringstream input(html);
+	size_t written = 0;
+	Html2Mark::Stats stats;
+	size_t before = allocated_size;
+	html2mark(input, [&written](const char *, size_t size) {
+			written += size;
+			}, Html2Mark::DEFAULT_OPTIONS, 20, 80, &stats);
+	ASSERT(allocated_size - before < 1024 * 1024);
+	EQUAL(written, html2mark(html).size());
+	EQUAL(stats.input_size, html.size());
+	EQUAL(stats.output_size, written);
+
+	std::istringstream again(html.substr(0, 1000) + "<p>unfinished &amp; <b>bold");
+	EQUAL(html2mark(again, Html2Mark::MAKE_REFERENCE_LINKS), html2mark(html.substr(0, 1000) + "<p>unfinished &amp; <b>bold", Html2Mark::MAKE_REFERENCE_LINKS));
+}
+
+TEST(should_write_finished_blocks_before_document_ends)
+{
+	std::string out;
+	Html2Mark::PushConverter converter([&out](const char * data, size_t size) {
+			out.append(data, size);
+			});
+	std::string first = "<p>first</p><p>sec";
+	converter.feed(first.data(), first.size());
+	EQUAL(out, html2mark(std::string("<p>first</p>")));
+	std::string second = "ond</p>";
+	converter.feed(second.data(), second.size());
+	converter.finish();
+	EQUAL(out, html2mark(first + second));
+}
+
+TEST(should_start_next_document_after_finish)
+{
+	std::string html = "<p><a href=\"http://example.com/a/long/link\">link</a></p><p>unfinished <b>bold";
+	std::string out;
+	Html2Mark::PushConverter converter([&out](const char * data, size_t size) {
+			out.append(data, size);
+			}, Html2Mark::MAKE_REFERENCE_LINKS);
+	for(int i = 0; i < 2; ++i) {
+		out.clear();
+		converter.feed(html.data(), 20);
+		converter.feed(html.data() + 20, html.size() - 20);
+		converter.finish();
+		EQUAL(out, html2mark(html, Html2Mark::MAKE_REFERENCE_LINKS));
+	}
+}
+
+}
+
+SUITE(parallel_converter) {
+
+TEST(should_number_references_across_pieces_as_one_thread_does)
+{
+	std::string html;
+	for(int i = 0; i < 40; ++i) {
+		html += "<p>Paragraph " + std::to_string(i);
+		html += " <a href=\"http://example.com/a/very/long/link/" + std::to_string(i) + "\">link</a></p>";
+		html += "<h1><img src=\"http://example.com/a/long/image/" + std::to_string(i) + "\"/></h1>";
+	}
+	for(int options : {int(Html2Mark::MAKE_REFERENCE_LINKS | Html2Mark::UNDERSCORED_HEADINGS), Html2Mark::COLORS | Html2Mark::WRAP | Html2Mark::MAKE_REFERENCE_LINKS}) {
+		Html2Mark::ParallelConverter converter(3, options, 20, 30, 16);
+		std::string out;
+		converter.convert(html, out);
+		EQUAL(out, html2mark(html, options, 20, 30));
+	}
+}
+
+TEST(should_reuse_references_made_in_other_pieces)
+{
+	std::string html;
+	for(int i = 0; i < 30; ++i) {
+		html += "<p><a href=\"http://example.com/nav/" + std::to_string(i % 4) + "/long/link\">nav</a>";
+		html += " <a href=\"http://example.com/page/" + std::to_string(i) + "/long/link\">";
+		html += "<img src=\"http://example.com/nav/" + std::to_string(i % 3) + "/long/link\"/></a></p>";
+	}
+	Html2Mark::ParallelConverter converter(3, Html2Mark::MAKE_REFERENCE_LINKS, 20, 80, 16);
+	std::string out;
+	converter.convert(html, out);
+	EQUAL(out, html2mark(html, Html2Mark::MAKE_REFERENCE_LINKS));
+}
+
+TEST(should_not_cut_document_inside_of_elements_or_tags)
+{
+	std::string html = "<ul>";
+	for(int i = 0; i < 20; ++i) {
+		html += "<li>item <a href=\"http://example.com/a/very/long/link\">link</a>";
+	}
+	html += "</ul><!-- <p>commented <a href=\"http://example.com/commented/link\">out</a></p> -->";
+	html += "<script>document.write('<p>')</script><p>text</p><p>more <b>text";
+	Html2Mark::ParallelConverter converter(3, Html2Mark::MAKE_REFERENCE_LINKS, 20, 80, 8);
+	std::string out;
+	converter.convert(html, out);
+	EQUAL(out, html2mark(html, Html2Mark::MAKE_REFERENCE_LINKS));
+}
+
+TEST(should_cut_output_at_the_same_block_as_one_thread_does)
+{
+	std::string html;
+	for(int i = 0; i < 200; ++i) {
+		html += "<p>paragraph " + std::to_string(i) + " <a href=\"http://example.com/" + std::to_string(i % 7) + "\">link</a></p>";
+	}
+	Html2Mark::Limits limits;
+	for(size_t max_output_size : {100u, 1000u, 5000u, 100000u}) {
+		limits.max_output_size = max_output_size;
+		Html2Mark::Converter converter(Html2Mark::MAKE_REFERENCE_LINKS, 10, 80, limits);
+		std::string expected;
+		Html2Mark::Status expected_status = converter.convert(html, expected);
+		Html2Mark::ParallelConverter parallel(3, Html2Mark::MAKE_REFERENCE_LINKS, 10, 80, 64, limits);
+		std::string out;
+		EQUAL(parallel.convert(html, out), expected_status);
+		EQUAL(out, expected);
+	}
+}
+
+}
+
+SUITE(thread_pool) {
+
+TEST(should_pass_exception_of_task_to_wait)
+{
+	Html2Mark::ThreadPool pool(3);
+	std::atomic<int> finished(0);
+	for(int i = 0; i < 10; ++i) {
+		pool.submit([&finished, i](size_t) {
+				if(i == 4) {
+					throw std::runtime_error("task failed");
+				}
+				++finished;
+				});
+	}
+	bool thrown = false;
+	try {
+		pool.wait();
+	} catch(const std::runtime_error & e) {
+		thrown = std::string(e.what()) == "task failed";
+	}
+	ASSERT(thrown);
+	EQUAL(finished.load(), 9);
+	pool.submit([&finished](size_t) { ++finished; });
+	pool.wait();
+	EQUAL(finished.load(), 10);
+}
+
+}
+
+SUITE(protocol) {
+
+TEST(should_pass_request_and_response_through_socket)
+{
+	int fds[2];
+	EQUAL(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+	Html2Mark::RequestHeader request;
+	request.kind = Html2Mark::CONVERT_REQUEST;
+	request.options = Html2Mark::WRAP;
+	request.wrap_width = 72;
+	request.min_reference_links_length = 15;
+	request.size = 0;
+	Html2Mark::write_message(fds[0], request, std::string("<p>text</p>"));
+	Html2Mark::ResponseHeader response;
+	response.status = Html2Mark::RESPONSE_TOO_LARGE;
+	Html2Mark::write_message(fds[1], response, Html2Mark::StringView());
+
+	Html2Mark::RequestHeader read_request;
+	std::string html;
+	ASSERT(Html2Mark::read_header(fds[1], read_request));
+	ASSERT(Html2Mark::read_body(fds[1], read_request.size, html));
+	EQUAL(read_request.kind, uint32_t(Html2Mark::CONVERT_REQUEST));
+	EQUAL(read_request.options, uint32_t(Html2Mark::WRAP));
+	EQUAL(read_request.wrap_width, 72u);
+	EQUAL(read_request.min_reference_links_length, 15u);
+	EQUAL(html, "<p>text</p>");
+	Html2Mark::ResponseHeader read_response;
+	std::string markdown = "stale";
+	ASSERT(Html2Mark::read_header(fds[0], read_response));
+	ASSERT(Html2Mark::read_body(fds[0], read_response.size, markdown));
+	EQUAL(read_response.status, uint32_t(Html2Mark::RESPONSE_TOO_LARGE));
+	EQUAL(markdown, "");
+	close(fds[0]);
+	close(fds[1]);
+}
+
+TEST(should_fail_to_read_truncated_message)
+{
+	int fds[2];
+	EQUAL(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+	const char header[] = {0, 0, 0, 0, 0, 0, 0, 9, 'p', 'a', 'r', 't'};
+	EQUAL(write(fds[0], header, sizeof(header)), ssize_t(sizeof(header)));
+	close(fds[0]);
+	Html2Mark::ResponseHeader response;
+	std::string body;
+	ASSERT(Html2Mark::read_header(fds[1], response));
+	EQUAL(response.size, 9u);
+	ASSERT(!Html2Mark::read_body(fds[1], response.size, body));
+	close(fds[1]);
+}
+
+TEST(should_not_write_body_larger_than_size_in_header_can_hold)
+{
+	int fds[2];
+	EQUAL(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds), 0);
+	Html2Mark::ResponseHeader response;
+	response.status = Html2Mark::RESPONSE_CONVERTED;
+	const char * data = "text";
+	ASSERT(!Html2Mark::write_message(fds[0], response,
+				Html2Mark::StringView(data, Html2Mark::MAX_BODY_SIZE + 1)));
+	char byte;
+	EQUAL(read(fds[1], &byte, 1), ssize_t(-1));
+	close(fds[0]);
+	close(fds[1]);
+}
+
+TEST(should_give_up_reading_slow_message_at_deadline)
+{
+	int fds[2];
+	EQUAL(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds), 0);
+	std::thread client([&fds]() {
+			for(int i = 0; i < 50; ++i) {
+				if(send(fds[0], "x", 1, MSG_NOSIGNAL) != 1) {
+					break;
+				}
+				std::this_thread::sleep_for(std::chrono::milliseconds(20));
+			}
+			});
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	Html2Mark::Deadline deadline = start + std::chrono::seconds(10);
+	std::string body;
+	ASSERT(Html2Mark::read_body(fds[1], 3, body, &deadline));
+	EQUAL(body, "xxx");
+	start = std::chrono::steady_clock::now();
+	deadline = start + std::chrono::milliseconds(100);
+	ASSERT(!Html2Mark::read_body(fds[1], 40, body, &deadline));
+	ASSERT(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(500));
+	shutdown(fds[1], SHUT_RDWR);
+	client.join();
+	close(fds[0]);
+	close(fds[1]);
+}
+
+}
+
+SUITE(c_interface) {
+
+TEST(should_convert_into_buffer_of_caller)
+{
+	html2mark_converter * converter = html2mark_create(HTML2MARK_UNDERSCORED_HEADINGS, 20, 80, nullptr);
+	ASSERT(converter != nullptr);
+	std::string html = "<h1>Header</h1><p>text</p>";
+	char out[64];
+	size_t out_size = 0;
+	EQUAL(html2mark_convert(converter, html.data(), html.size(), out, sizeof(out), &out_size), int(HTML2MARK_OK));
+	EQUAL(std::string(out, out_size), html2mark(html, Html2Mark::UNDERSCORED_HEADINGS));
+	html2mark_free(converter);
+}
+
+TEST(should_give_size_of_output_that_does_not_fit)
+{
+	html2mark_converter * converter = html2mark_create(0, 20, 80, nullptr);
+	std::string html = "<p>some text</p>";
+	char out[4] = {'x', 'x', 'x', 'x'};
+	size_t out_size = 0;
+	EQUAL(html2mark_convert(converter, html.data(), html.size(), out, sizeof(out), &out_size), int(HTML2MARK_BUFFER_TOO_SMALL));
+	EQUAL(out_size, html2mark(html).size());
+	EQUAL(out[0], 'x');
+	const char * output = nullptr;
+	EQUAL(html2mark_output(converter, &output, &out_size), int(HTML2MARK_OK));
+	EQUAL(std::string(output, out_size), html2mark(html));
+	html2mark_free(converter);
+}
+
+TEST(should_report_limits_and_invalid_arguments)
+{
+	EQUAL(html2mark_create(0x100, 20, 80, nullptr), static_cast<html2mark_converter *>(nullptr));
+	EQUAL(html2mark_create(HTML2MARK_WRAP, 20, 0, nullptr), static_cast<html2mark_converter *>(nullptr));
+	html2mark_limits limits = {0, 16, 0, 0};
+	html2mark_converter * converter = html2mark_create(0, 20, 80, &limits);
+	size_t out_size = 0;
+	EQUAL(html2mark_convert(converter, nullptr, 1, nullptr, 0, &out_size), int(HTML2MARK_INVALID_ARGUMENT));
+	std::string html = "<p>short</p><p>long enough to be cut</p>";
+	char out[64];
+	EQUAL(html2mark_convert(converter, html.data(), html.size(), out, sizeof(out), &out_size), int(HTML2MARK_OUTPUT_TOO_LARGE));
+	EQUAL(std::string(out, out_size), html2mark("<p>short</p>"));
+	html2mark_free(converter);
+	html2mark_free(nullptr);
+}
+
+TEST(should_convert_correctly_after_running_out_of_memory)
+{
+	int options = HTML2MARK_UNDERSCORED_HEADINGS | HTML2MARK_MAKE_REFERENCE_LINKS
+		| HTML2MARK_COLORS | HTML2MARK_WRAP;
+	std::string html = "<h1>Title</h1><ul><li><b>bold <i>text <a href=\"http://example.com/a/long/link\">link"
+		"</a></i></b><blockquote><p>quoted <code>code</code> with some words to be wrapped<ol><li>item";
+	std::string next = "<p>Next <b>document</b> <a href=\"http://example.com/another/link\">link</a></p>";
+	html2mark_converter * fresh = html2mark_create(options, 10, 20, nullptr);
+	size_t expected_size = 0;
+	const char * expected = nullptr;
+	html2mark_convert(fresh, next.data(), next.size(), nullptr, 0, &expected_size);
+	EQUAL(html2mark_output(fresh, &expected, &expected_size), int(HTML2MARK_OK));
+
+	html2mark_converter * converter = html2mark_create(options, 10, 20, nullptr);
+	int status = HTML2MARK_OUT_OF_MEMORY;
+	for(size_t failing = 1; status == HTML2MARK_OUT_OF_MEMORY; ++failing) {
+		size_t out_size = 0;
+		failing_allocation = failing;
+		status = html2mark_convert(converter, html.data(), html.size(), nullptr, 0, &out_size);
+		failing_allocation = 0;
+		html2mark_convert(converter, next.data(), next.size(), nullptr, 0, &out_size);
+		const char * out = nullptr;
+		html2mark_output(converter, &out, &out_size);
+		EQUAL(std::string(out, out_size), std::string(expected, expected_size));
+	}
+	html2mark_free(converter);
+	html2mark_free(fresh);
+}
+
+}